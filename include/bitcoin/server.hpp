@@ -28,6 +28,7 @@
 #include <bitcoin/server/channels/channel_stratum_v1.hpp>
 #include <bitcoin/server/channels/channel_stratum_v2.hpp>
 #include <bitcoin/server/channels/channels.hpp>
+#include <bitcoin/server/channels/method_router.hpp>
 #include <bitcoin/server/interfaces/admin.hpp>
 #include <bitcoin/server/interfaces/bitcoind_blockchain.hpp>
 #include <bitcoin/server/interfaces/bitcoind_control.hpp>
@@ -51,13 +52,19 @@
 #include <bitcoin/server/parsers/bitcoind_script.hpp>
 #include <bitcoin/server/parsers/bitcoind_target.hpp>
 #include <bitcoin/server/parsers/block_stats.hpp>
+#include <bitcoin/server/parsers/block_touched.hpp>
 #include <bitcoin/server/parsers/btcd_filter.hpp>
+#include <bitcoin/server/parsers/byte_range.hpp>
+#include <bitcoin/server/parsers/content_coding.hpp>
 #include <bitcoin/server/parsers/descriptor.hpp>
 #include <bitcoin/server/parsers/electrum_version.hpp>
+#include <bitcoin/server/parsers/entity_tag.hpp>
+#include <bitcoin/server/parsers/fee_histogram.hpp>
 #include <bitcoin/server/parsers/native_query.hpp>
 #include <bitcoin/server/parsers/native_target.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
 #include <bitcoin/server/parsers/partial_merkle.hpp>
+#include <bitcoin/server/parsers/tx_package.hpp>
 #include <bitcoin/server/protocols/protocol.hpp>
 #include <bitcoin/server/protocols/protocol_admin.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind.hpp>
@@ -82,6 +89,20 @@
 #include <bitcoin/server/protocols/protocol_stratum_v1.hpp>
 #include <bitcoin/server/protocols/protocol_stratum_v2.hpp>
 #include <bitcoin/server/protocols/protocols.hpp>
+#include <bitcoin/server/services/chain_snapshot.hpp>
+#include <bitcoin/server/services/fee_snapshot.hpp>
+#include <bitcoin/server/services/header_merkle.hpp>
+#include <bitcoin/server/services/header_snapshot.hpp>
+#include <bitcoin/server/services/merkle_cache.hpp>
+#include <bitcoin/server/services/outpoint_index.hpp>
+#include <bitcoin/server/services/response_cache.hpp>
+#include <bitcoin/server/services/rpc_calls.hpp>
+#include <bitcoin/server/services/scripthash_index.hpp>
+#include <bitcoin/server/services/scripthash_status.hpp>
+#include <bitcoin/server/services/services.hpp>
+#include <bitcoin/server/services/subscription_index.hpp>
+#include <bitcoin/server/services/subscription_table.hpp>
+#include <bitcoin/server/services/subscription_usage.hpp>
 #include <bitcoin/server/sessions/session.hpp>
 #include <bitcoin/server/sessions/session_handshake.hpp>
 #include <bitcoin/server/sessions/session_server.hpp>
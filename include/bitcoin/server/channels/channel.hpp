@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SERVER_CHANNELS_CHANNEL_HPP
 
 #include <memory>
+#include <bitcoin/server/channels/method_router.hpp>
 #include <bitcoin/server/define.hpp>
 
 namespace libbitcoin {
@@ -33,6 +34,16 @@ public:
     typedef std::shared_ptr<channel> ptr;
     using base = node::channel;
     using base::channel;
+
+    /// Json-rpc routes of the attached protocols (requires strand).
+    inline method_router& router() NOEXCEPT
+    {
+        return router_;
+    }
+
+private:
+    // This is protected by strand.
+    method_router router_{};
 };
 
 } // namespace server
@@ -31,6 +31,10 @@ namespace server {
 
 // TODO: strip extraneous args before electrum version dispatch.
 /// Channel for electrum channels (non-http json-rpc).
+/// Batch arrays are parsed by channel_rpc and each element is dispatched in
+/// order, after completion of the previous (reads are paused while a query
+/// is monitored). The responses are returned as one array in request order,
+/// and the batch is bounded in bytes by electrum maximum_request.
 class BCS_API channel_electrum
   : public server::channel,
     public network::channel_rpc<interface::electrum>,
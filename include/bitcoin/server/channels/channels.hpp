@@ -24,6 +24,7 @@
 #include <bitcoin/server/channels/channel_http.hpp>
 #include <bitcoin/server/channels/channel_stratum_v1.hpp>
 #include <bitcoin/server/channels/channel_stratum_v2.hpp>
+#include <bitcoin/server/channels/method_router.hpp>
 
 #endif
 
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_CHANNELS_METHOD_ROUTER_HPP
+#define LIBBITCOIN_SERVER_CHANNELS_METHOD_ROUTER_HPP
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Not thread safe (requires channel strand).
+/// Per-channel json-rpc routing to the protocols attached to the channel.
+/// Method names are resolved to an owner ordinal by a (static) merged table,
+/// and each attached owner sets its handler at that ordinal upon start. So a
+/// request reaches its owning handler with one hash lookup (no fan-out).
+class method_router
+{
+public:
+    using table = std::unordered_map<std::string, size_t>;
+    using handler = std::function<void(const network::rpc::request_t&,
+        const network::http::request_cptr&)>;
+
+    /// Set the handler of the owner ordinal.
+    inline void set(size_t ordinal, handler&& route) NOEXCEPT
+    {
+        if (ordinal >= handlers_.size())
+            handlers_.resize(add1(ordinal));
+
+        handlers_.at(ordinal) = std::move(route);
+    }
+
+    /// Route the message to the handler of its owner, false if none. The
+    /// request is null for websocket messages (no http request to echo).
+    inline bool route(const table& methods,
+        const network::rpc::request_t& message,
+        const network::http::request_cptr& request) const NOEXCEPT
+    {
+        const auto it = methods.find(message.method);
+        if (it == methods.end() || it->second >= handlers_.size() ||
+            !handlers_.at(it->second))
+            return false;
+
+        handlers_.at(it->second)(message, request);
+        return true;
+    }
+
+    /// Release all handlers (they retain their protocols).
+    inline void clear() NOEXCEPT
+    {
+        handlers_.clear();
+    }
+
+private:
+    std::vector<handler> handlers_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -69,7 +69,8 @@ enum error_t : uint8_t
     maximum_depth,
     wrong_version,
     server_error,
-    method_unauthorized
+    method_unauthorized,
+    server_busy
 };
 
 // No current need for error_code equivalence mapping.
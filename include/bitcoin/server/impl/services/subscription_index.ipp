@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_INDEX_IPP
+#define LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_INDEX_IPP
+
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+#define TEMPLATE template <typename Key>
+#define CLASS subscription_index<Key>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Subscriptions.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+void CLASS::subscribe(uint64_t channel, const Key& key) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    index_[key].insert(channel);
+    subscriptions_[channel].insert(key);
+}
+
+TEMPLATE
+void CLASS::unsubscribe(uint64_t channel, const Key& key) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    const auto it = index_.find(key);
+    if (it != index_.end())
+    {
+        it->second.erase(channel);
+        if (it->second.empty())
+            index_.erase(it);
+    }
+
+    const auto at = subscriptions_.find(channel);
+    if (at != subscriptions_.end())
+    {
+        at->second.erase(key);
+        if (at->second.empty())
+            subscriptions_.erase(at);
+    }
+}
+
+TEMPLATE
+void CLASS::unsubscribe(uint64_t channel) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    const auto at = subscriptions_.find(channel);
+    if (at == subscriptions_.end())
+        return;
+
+    for (const auto& key: at->second)
+    {
+        const auto it = index_.find(key);
+        if (it != index_.end())
+        {
+            it->second.erase(channel);
+            if (it->second.empty())
+                index_.erase(it);
+        }
+    }
+
+    subscriptions_.erase(at);
+}
+
+TEMPLATE
+size_t CLASS::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return index_.size();
+}
+
+// Notification.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+void CLASS::touched(keys& out, const database::header_link& link,
+    const key_set& set, uint64_t channel) NOEXCEPT
+{
+    if (!find(out, link, channel))
+    {
+        intersect(link, set);
+        find(out, link, channel);
+    }
+}
+
+// protected
+TEMPLATE
+bool CLASS::find(keys& out, const database::header_link& link,
+    uint64_t channel) const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    for (const auto& [block, channels]: recent_)
+    {
+        if (block == link)
+        {
+            const auto it = channels.find(channel);
+            if (it != channels.end())
+                out = it->second;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// private
+TEMPLATE
+void CLASS::intersect(const database::header_link& link,
+    const key_set& set) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (const auto& [block, channels]: recent_)
+        if (block == link)
+            return;
+
+    // Iterate the smaller of the two sets.
+    woken wake{};
+    if (set.size() < index_.size())
+    {
+        for (const auto& key: set)
+        {
+            const auto it = index_.find(key);
+            if (it != index_.end())
+                for (const auto channel: it->second)
+                    wake[channel].push_back(key);
+        }
+    }
+    else
+    {
+        for (const auto& [key, channels]: index_)
+            if (set.contains(key))
+                for (const auto channel: channels)
+                    wake[channel].push_back(key);
+    }
+
+    if (recent_.size() == recent_blocks)
+        recent_.pop_front();
+
+    recent_.emplace_back(link, std::move(wake));
+}
+
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_TABLE_IPP
+#define LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_TABLE_IPP
+
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+#define TEMPLATE template <typename Key, typename Value, typename Hash>
+#define CLASS subscription_table<Key, Value, Hash>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// iterator
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <typename Table, typename Slot>
+CLASS::basic_iterator<Table, Slot>::basic_iterator(Table* table,
+    size_t index) NOEXCEPT
+  : table_(table), index_(index)
+{
+    skip();
+}
+
+TEMPLATE
+template <typename Table, typename Slot>
+typename CLASS::template basic_iterator<Table, Slot>::reference
+CLASS::basic_iterator<Table, Slot>::operator*() const NOEXCEPT
+{
+    return table_->slots_.at(index_);
+}
+
+TEMPLATE
+template <typename Table, typename Slot>
+typename CLASS::template basic_iterator<Table, Slot>::pointer
+CLASS::basic_iterator<Table, Slot>::operator->() const NOEXCEPT
+{
+    return &table_->slots_.at(index_);
+}
+
+TEMPLATE
+template <typename Table, typename Slot>
+typename CLASS::template basic_iterator<Table, Slot>&
+CLASS::basic_iterator<Table, Slot>::operator++() NOEXCEPT
+{
+    ++index_;
+    skip();
+    return *this;
+}
+
+TEMPLATE
+template <typename Table, typename Slot>
+typename CLASS::template basic_iterator<Table, Slot>
+CLASS::basic_iterator<Table, Slot>::operator++(int) NOEXCEPT
+{
+    auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+TEMPLATE
+template <typename Table, typename Slot>
+bool CLASS::basic_iterator<Table, Slot>::operator==(
+    const basic_iterator& other) const NOEXCEPT
+{
+    return index_ == other.index_;
+}
+
+// Advance to the next occupied slot (or end).
+TEMPLATE
+template <typename Table, typename Slot>
+void CLASS::basic_iterator<Table, Slot>::skip() NOEXCEPT
+{
+    const auto end = table_->capacity();
+    while (index_ < end && !table_->used_.at(index_))
+        ++index_;
+}
+
+// properties
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+size_t CLASS::size() const NOEXCEPT
+{
+    return size_;
+}
+
+TEMPLATE
+bool CLASS::empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+TEMPLATE
+size_t CLASS::capacity() const NOEXCEPT
+{
+    return slots_.size();
+}
+
+TEMPLATE
+size_t CLASS::memory() const NOEXCEPT
+{
+    // Occupancy is bit-packed (std::vector<bool>).
+    return capacity() * sizeof(value_type) + ceilinged_divide(capacity(),
+        system::byte_bits);
+}
+
+// iteration
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::iterator CLASS::begin() NOEXCEPT
+{
+    return { this, zero };
+}
+
+TEMPLATE
+typename CLASS::iterator CLASS::end() NOEXCEPT
+{
+    return { this, capacity() };
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::begin() const NOEXCEPT
+{
+    return { this, zero };
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::end() const NOEXCEPT
+{
+    return { this, capacity() };
+}
+
+// lookup
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::iterator CLASS::find(const Key& key) NOEXCEPT
+{
+    return { this, locate(key) };
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::find(const Key& key) const NOEXCEPT
+{
+    return { this, locate(key) };
+}
+
+TEMPLATE
+bool CLASS::contains(const Key& key) const NOEXCEPT
+{
+    return locate(key) != capacity();
+}
+
+// mutation
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+std::pair<typename CLASS::iterator, bool> CLASS::try_emplace(const Key& key,
+    Value&& value) NOEXCEPT
+{
+    if (const auto index = locate(key); index != capacity())
+        return { { this, index }, false };
+
+    reserve_one();
+    auto index = home(key);
+    while (used_.at(index))
+        index = next(index);
+
+    slots_.at(index) = { key, std::move(value) };
+    used_.at(index) = true;
+    ++size_;
+    return { { this, index }, true };
+}
+
+TEMPLATE
+std::pair<typename CLASS::iterator, bool> CLASS::try_emplace(const Key& key,
+    const Value& value) NOEXCEPT
+{
+    return try_emplace(key, Value{ value });
+}
+
+TEMPLATE
+size_t CLASS::erase(const Key& key) NOEXCEPT
+{
+    const auto index = locate(key);
+    if (index == capacity())
+        return zero;
+
+    erase_at(index);
+    return one;
+}
+
+TEMPLATE
+void CLASS::erase(const iterator& it) NOEXCEPT
+{
+    BC_ASSERT(it.index_ < capacity() && used_.at(it.index_));
+    erase_at(it.index_);
+}
+
+TEMPLATE
+void CLASS::release() NOEXCEPT
+{
+    // Swap with empty frees the storage (clear() retains capacity).
+    std::vector<value_type>{}.swap(slots_);
+    std::vector<bool>{}.swap(used_);
+    size_ = zero;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+size_t CLASS::home(const Key& key) const NOEXCEPT
+{
+    BC_ASSERT(!is_zero(capacity()));
+    return Hash{}(key) & sub1(capacity());
+}
+
+TEMPLATE
+size_t CLASS::next(size_t index) const NOEXCEPT
+{
+    return add1(index) & sub1(capacity());
+}
+
+// The slot of the key, or capacity() if not found. A probe run ends at the
+// first empty slot, and load is bounded, so there is always an empty slot.
+TEMPLATE
+size_t CLASS::locate(const Key& key) const NOEXCEPT
+{
+    if (is_zero(size_))
+        return capacity();
+
+    for (auto index = home(key); used_.at(index); index = next(index))
+        if (slots_.at(index).first == key)
+            return index;
+
+    return capacity();
+}
+
+// Backward shift deletion: each following entry of the probe run that may
+// legally occupy the hole (its home is not cyclically within (hole, entry])
+// is moved into it, so that no run is broken and no tombstone is required.
+TEMPLATE
+void CLASS::erase_at(size_t hole) NOEXCEPT
+{
+    const auto mask = sub1(capacity());
+    for (auto index = next(hole); used_.at(index); index = next(index))
+    {
+        const auto distance = (index - home(slots_.at(index).first)) & mask;
+        if (distance >= ((index - hole) & mask))
+        {
+            slots_.at(hole) = std::move(slots_.at(index));
+            hole = index;
+        }
+    }
+
+    // Reset the vacated slot, releasing any heap owned by its value.
+    slots_.at(hole) = value_type{};
+    used_.at(hole) = false;
+    --size_;
+}
+
+// Double the capacity if one more entry would exceed 3/4 load.
+TEMPLATE
+void CLASS::reserve_one() NOEXCEPT
+{
+    const auto slots = capacity();
+    if (!is_zero(slots) && add1(size_) * 4u <= slots * 3u)
+        return;
+
+    std::vector<value_type> slots_prior{};
+    std::vector<bool> used_prior{};
+    slots_prior.swap(slots_);
+    used_prior.swap(used_);
+
+    const auto size = is_zero(slots) ? minimum_capacity : two * slots;
+    slots_.resize(size);
+    used_.resize(size);
+
+    for (size_t index{}; index < slots; ++index)
+    {
+        if (!used_prior.at(index))
+            continue;
+
+        auto at = home(slots_prior.at(index).first);
+        while (used_.at(at))
+            at = next(at);
+
+        slots_.at(at) = std::move(slots_prior.at(index));
+        used_.at(at) = true;
+    }
+}
+
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
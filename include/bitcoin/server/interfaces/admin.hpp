@@ -31,7 +31,8 @@ struct admin_methods
     static constexpr std::tuple methods
     {
         method<"log_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" },
-        method<"event_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" }
+        method<"event_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" },
+        method<"subscriptions", uint8_t>{ "version" }
     };
 
     template <typename... Args>
@@ -44,6 +45,7 @@ struct admin_methods
 
     using log_subscribe = at<0>;
     using event_subscribe = at<1>;
+    using subscriptions = at<2>;
 };
 
 /// ?format=data|text|json (via query string).
@@ -58,6 +60,14 @@ struct admin_methods
 /// /v1/log/subscribe?filter=[mask] {stream}
 /// /v1/event/subscribe?filter=[mask] {stream}
 
+/// The subscriptions result reports the total of subscriptions held by all
+/// electrum channels, the bytes of their subscription tables (including heap
+/// owned by entries) and of the shared address status (including checkpoint
+/// vectors), and the (integer) quotient, memory per subscription (zero if
+/// none). Allocator overhead is not included.
+
+/// /v1/subscriptions
+
 } // namespace interface
 } // namespace server
 } // namespace libbitcoin
@@ -46,7 +46,7 @@ struct bitcoind_transaction_methods
         method<"utxoupdatepsbt">{ unimplemented },
         method<"abortprivatebroadcast">{ unimplemented },
         method<"getprivatebroadcastinfo">{ unimplemented },
-        method<"submitpackage">{ unimplemented }
+        method<"submitpackage", array_t, optional<0.0>, optional<0.0>>{ "package", "maxfeerate", "maxburnamount" }
     };
 
     template <typename... Args>
@@ -54,11 +54,12 @@ struct electrum_methods
         method<"blockchain.address.subscribe", string_t>{ "address" },
 
         method<"blockchain.scripthash.get_balance", string_t>{ "scripthash" },
-        method<"blockchain.scripthash.get_history", string_t>{ "scripthash" },
+        method<"blockchain.scripthash.get_history", string_t, optional<0.0>>{ "scripthash", "from_height" },
         method<"blockchain.scripthash.get_mempool", string_t>{ "scripthash" },
         method<"blockchain.scripthash.listunspent", string_t>{ "scripthash" },
         method<"blockchain.scripthash.subscribe", string_t>{ "scripthash" },
         method<"blockchain.scripthash.unsubscribe", string_t>{ "scripthash" },
+        method<"blockchain.scripthash.subscribe_many", array_t>{ "scripthashes" },
 
         method<"blockchain.scriptpubkey.get_balance", string_t>{ "scriptpubkey" },
         method<"blockchain.scriptpubkey.get_history", string_t>{ "scriptpubkey" },
@@ -120,30 +121,31 @@ struct electrum_methods
     using blockchain_scripthash_list_unspent = at<20>;
     using blockchain_scripthash_subscribe = at<21>;
     using blockchain_scripthash_unsubscribe = at<22>;
-
-    using blockchain_scriptpubkey_get_balance = at<23>;
-    using blockchain_scriptpubkey_get_history = at<24>;
-    using blockchain_scriptpubkey_get_mempool = at<25>;
-    using blockchain_scriptpubkey_list_unspent = at<26>;
-    using blockchain_scriptpubkey_subscribe = at<27>;
-    using blockchain_scriptpubkey_unsubscribe = at<28>;
-
-    using blockchain_transaction_broadcast = at<29>;
-    using blockchain_transaction_broadcast_package = at<30>;
-    using blockchain_transaction_get = at<31>;
-    using blockchain_transaction_get_merkle = at<32>;
-    using blockchain_transaction_id_from_position = at<33>;
-
-    using server_add_peer = at<34>;
-    using server_banner = at<35>;
-    using server_donation_address = at<36>;
-    using server_features = at<37>;
-    using server_peers_subscribe = at<38>;
-    using server_ping = at<39>;
-    using server_version = at<40>;
-
-    using mempool_get_fee_histogram = at<41>;
-    using mempool_get_info = at<42>;
+    using blockchain_scripthash_subscribe_many = at<23>;
+
+    using blockchain_scriptpubkey_get_balance = at<24>;
+    using blockchain_scriptpubkey_get_history = at<25>;
+    using blockchain_scriptpubkey_get_mempool = at<26>;
+    using blockchain_scriptpubkey_list_unspent = at<27>;
+    using blockchain_scriptpubkey_subscribe = at<28>;
+    using blockchain_scriptpubkey_unsubscribe = at<29>;
+
+    using blockchain_transaction_broadcast = at<30>;
+    using blockchain_transaction_broadcast_package = at<31>;
+    using blockchain_transaction_get = at<32>;
+    using blockchain_transaction_get_merkle = at<33>;
+    using blockchain_transaction_id_from_position = at<34>;
+
+    using server_add_peer = at<35>;
+    using server_banner = at<36>;
+    using server_donation_address = at<37>;
+    using server_features = at<38>;
+    using server_peers_subscribe = at<39>;
+    using server_ping = at<40>;
+    using server_version = at<41>;
+
+    using mempool_get_fee_histogram = at<42>;
+    using mempool_get_info = at<43>;
 };
 
 } // namespace interface
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_BLOCK_TOUCHED_HPP
+#define LIBBITCOIN_SERVER_PARSERS_BLOCK_TOUCHED_HPP
+
+#include <unordered_set>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using scripthash_set = std::unordered_set<system::hash_digest>;
+using point_set = std::unordered_set<system::chain::point>;
+
+/// The electrum scripthashes of all output scripts and (populated) prevout
+/// scripts of the block, the keys of all address histories the block changes.
+BCS_API void touched_scripthashes(scripthash_set& out,
+    const system::chain::block& block) NOEXCEPT;
+
+/// The outputs created and prevouts spent by the block, the keys of all
+/// outpoint histories (output height or spenders) the block changes.
+BCS_API void touched_outpoints(point_set& out,
+    const system::chain::block& block) NOEXCEPT;
+
+/// The outputs of the block paying to the scripthash and the (populated)
+/// prevouts it spends from the scripthash, the address outpoints it changes.
+BCS_API void touched_address(database::outpoints& out,
+    const system::chain::block& block,
+    const system::hash_digest& scripthash) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
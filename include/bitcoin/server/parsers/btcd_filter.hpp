@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SERVER_PARSERS_BTCD_FILTER_HPP
 
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/block_touched.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -34,6 +35,13 @@ BCS_API code filter_keys(system::hashes& out,
 BCS_API code filter_points(system::chain::points& out,
     const network::rpc::value_t& outpoints) NOEXCEPT;
 
+/// The block txs (in block order) that pay to or spend from a watched output
+/// script hash, or that spend a watched outpoint. Spends from a watched script
+/// hash are matched only where prevouts are populated.
+BCS_API system::chain::transaction_cptrs filter_block(
+    const system::chain::block& block, const scripthash_set& keys,
+    const point_set& points) NOEXCEPT;
+
 } // namespace btcd
 } // namespace server
 } // namespace libbitcoin
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_BYTE_RANGE_HPP
+#define LIBBITCOIN_SERVER_PARSERS_BYTE_RANGE_HPP
+
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Inclusive range [first, last] of a representation of size bytes.
+struct byte_range
+{
+    size_t first{};
+    size_t last{};
+    size_t size{};
+
+    /// The number of bytes in the range.
+    size_t length() const NOEXCEPT;
+};
+
+/// The disposition of a Range field value (RFC 9110 section 14.2).
+enum class range_request : uint8_t
+{
+    /// Absent, not bytes, invalid or multiple ranges (send full content).
+    full,
+
+    /// A single satisfiable range (send partial content).
+    partial,
+
+    /// A single unsatisfiable range (send range not satisfiable).
+    unsatisfiable
+};
+
+/// Parse a single byte range ("bytes=first-last", "bytes=first-" or
+/// "bytes=-suffix") against the representation size, with last clamped to
+/// the representation. Multiple ranges are not supported (full).
+BCS_API range_request parse_range(byte_range& out, std::string_view range,
+    size_t size) NOEXCEPT;
+
+/// The Content-Range field value of a satisfiable range ("bytes a-b/size").
+BCS_API std::string to_content_range(const byte_range& range) NOEXCEPT;
+
+/// The Content-Range field value of an unsatisfiable range ("bytes */size").
+BCS_API std::string to_content_range(size_t size) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_CONTENT_CODING_HPP
+#define LIBBITCOIN_SERVER_PARSERS_CONTENT_CODING_HPP
+
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Response content codings (RFC 9110), in order of preference.
+enum class content_coding : uint8_t
+{
+    identity,
+    deflate,
+    gzip
+};
+
+/// The preferred coding of the Accept-Encoding field value, by quality and
+/// then by gzip over deflate, identity if neither is acceptable.
+BCS_API content_coding negotiate_coding(
+    std::string_view accept_encoding) NOEXCEPT;
+
+/// The Content-Encoding field value of the coding.
+BCS_API std::string_view from_content_coding(content_coding coding) NOEXCEPT;
+
+/// Compress the body in the coding (gzip RFC 1952, deflate RFC 1950), empty
+/// for identity.
+BCS_API std::string compress(std::string_view body,
+    content_coding coding) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_ENTITY_TAG_HPP
+#define LIBBITCOIN_SERVER_PARSERS_ENTITY_TAG_HPP
+
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Strong entity tag (quoted, RFC 9110) of an immutable resource, the digest
+/// of its interface, method, object hash, distinguishing params and media.
+BCS_API std::string entity_tag(std::string_view interface,
+    std::string_view method, const system::hash_digest& hash,
+    std::string_view params, network::http::media_type media) NOEXCEPT;
+
+/// True if the If-None-Match field value is "*", which matches any current
+/// representation, so the caller must first establish that one exists.
+BCS_API bool entity_wildcard(std::string_view if_none_match) NOEXCEPT;
+
+/// True if the If-None-Match field value lists the entity tag, by weak
+/// comparison (as required for If-None-Match). "*" is not matched here.
+BCS_API bool entity_match(std::string_view if_none_match,
+    std::string_view tag) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
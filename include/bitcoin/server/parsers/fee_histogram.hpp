@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_FEE_HISTOGRAM_HPP
+#define LIBBITCOIN_SERVER_PARSERS_FEE_HISTOGRAM_HPP
+
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Virtual size (vbytes) by fee rate (satoshis per vbyte), descending rate.
+using fee_rates = std::map<uint64_t, uint64_t, std::greater<uint64_t>>;
+
+/// Electrum compact fee histogram bin: fee rate and the cumulative virtual
+/// size of txs with rates below the prior bin's rate and at least this one.
+using fee_bin = std::pair<uint64_t, uint64_t>;
+using fee_bins = std::vector<fee_bin>;
+
+/// The initial minimum virtual size of a bin (electrumx), grown by 10% with
+/// each emitted bin.
+constexpr uint64_t fee_bin_size = 30'000;
+
+/// Compact fee rates to the electrum histogram (electrumx algorithm). A
+/// trailing partial bin (below the bin size) is not emitted.
+BCS_API fee_bins compact_fee_rates(const fee_rates& rates,
+    uint64_t bin_size=fee_bin_size) NOEXCEPT;
+
+/// The compact fee histogram of a prevout-populated block's non-coinbase
+/// txs, a proxy for the pool that the block most recently cleared. A tx with
+/// any unpopulated prevout is skipped (its fee is unknown).
+BCS_API fee_bins fee_histogram(const system::chain::block& block) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
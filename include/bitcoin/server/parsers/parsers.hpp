@@ -24,11 +24,17 @@
 #include <bitcoin/server/parsers/bitcoind_script.hpp>
 #include <bitcoin/server/parsers/bitcoind_target.hpp>
 #include <bitcoin/server/parsers/block_stats.hpp>
+#include <bitcoin/server/parsers/block_touched.hpp>
 #include <bitcoin/server/parsers/btcd_filter.hpp>
+#include <bitcoin/server/parsers/byte_range.hpp>
+#include <bitcoin/server/parsers/content_coding.hpp>
 #include <bitcoin/server/parsers/descriptor.hpp>
 #include <bitcoin/server/parsers/electrum_version.hpp>
+#include <bitcoin/server/parsers/entity_tag.hpp>
+#include <bitcoin/server/parsers/fee_histogram.hpp>
 #include <bitcoin/server/parsers/native_query.hpp>
 #include <bitcoin/server/parsers/native_target.hpp>
 #include <bitcoin/server/parsers/partial_merkle.hpp>
+#include <bitcoin/server/parsers/tx_package.hpp>
 
 #endif
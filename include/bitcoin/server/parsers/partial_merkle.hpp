@@ -28,6 +28,19 @@ namespace server {
 /// tree construction; the merkle block that wraps it is the wire form used by
 /// bitcoind's gettxoutproof/verifytxoutproof and the p2p merkleblock message.
 
+/// The fully materialized merkle tree of a block, by level. The first level is
+/// the txids (in block order) and the last is the root, with each odd level
+/// end paired with itself (as bitcoin). Empty for empty txids.
+using merkle_levels = std::vector<system::hashes>;
+
+/// Compute all merkle levels from the block's txids (one hash per node).
+BCS_API merkle_levels to_merkle_levels(system::hashes&& txids) NOEXCEPT;
+
+/// The merkle branch (sibling hashes, leaf to root) of the txid at position,
+/// as block::merkle_branch. Requires position < levels.front().size().
+BCS_API system::hashes merkle_branch(const merkle_levels& levels,
+    size_t position) NOEXCEPT;
+
 /// Build the flags and branch hashes proving the matched txids within a block
 /// whose full txid list (in block order) is given. match[i] flags txids[i].
 /// Requires match.size() == txids.size() and a non-empty txids.
@@ -35,6 +48,12 @@ BCS_API void build_partial_merkle(system::data_chunk& flags,
     system::hashes& branch, const system::hashes& txids,
     const std::vector<bool>& match) NOEXCEPT;
 
+/// As above, given the block's materialized merkle levels (no hashing).
+/// Requires match.size() == levels.front().size() and non-empty levels.
+BCS_API void build_partial_merkle(system::data_chunk& flags,
+    system::hashes& branch, const merkle_levels& levels,
+    const std::vector<bool>& match) NOEXCEPT;
+
 /// Extract the merkle root and matched txids (with their positions) from a
 /// partial merkle tree of the given transaction count. Returns false if the
 /// tree is malformed, in which case outputs are unspecified. A true return
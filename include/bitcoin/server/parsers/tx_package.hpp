@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_TX_PACKAGE_HPP
+#define LIBBITCOIN_SERVER_PARSERS_TX_PACKAGE_HPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Maximum number of transactions in a package (as bitcoind).
+constexpr size_t maximum_package_count = 25;
+
+/// Validation state of a package, shared across the parallel pool. Each
+/// transaction is validated independently into its own fault slot, with
+/// in-package prevouts populated beforehand (see populate_package).
+struct tx_package
+{
+    using ptr = std::shared_ptr<tx_package>;
+
+    system::chain::transaction_cptrs txs{};
+    std::vector<code> faults{};
+    std::atomic_size_t remaining{};
+};
+
+/// Parse an array of hex encoded transactions into a topologically ordered
+/// package, in which each transaction follows any in-package parent and the
+/// given order is otherwise preserved. Empty, oversized, undecodable,
+/// duplicated, conflicting (double spend) or cyclic packages are invalid.
+BCS_API code parse_package(system::chain::transaction_cptrs& out,
+    const network::rpc::array_t& raw_txs) NOEXCEPT;
+
+/// Topologically order a package in place (see parse_package).
+BCS_API code order_package(system::chain::transaction_cptrs& txs) NOEXCEPT;
+
+/// Populate the prevout of each input that spends an output of an in-package
+/// parent, as the store cannot provide it. Populated inputs are not queried.
+BCS_API void populate_package(
+    const system::chain::transaction_cptrs& txs) NOEXCEPT;
+
+/// Fault each valid transaction that spends an output of a faulted in-package
+/// parent, so that no child is accepted without its parent. The package must
+/// be topologically ordered, so a fault propagates to all descendants.
+BCS_API void reject_orphans(tx_package& package) NOEXCEPT;
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
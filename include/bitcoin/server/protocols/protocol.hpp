@@ -26,6 +26,8 @@
 namespace libbitcoin {
 namespace server {
 
+class server_node;
+
 /// Abstract base server protocol.
 class BCS_API protocol
   : public node::protocol,
@@ -37,6 +39,7 @@ public:
     inline protocol(const auto& session,
         const network::channel::ptr& channel) NOEXCEPT
       : node::protocol(session, channel),
+        server_(session->server()),
         config_(session->server_config()),
         network::tracker<protocol>(session->log)
     {
@@ -54,7 +57,15 @@ public:
         return server_config().server;
     }
 
+    /// The server node (services shared across channels).
+    /// Include server_node.hpp in the implementation to use services.
+    inline server_node& server() const NOEXCEPT
+    {
+        return server_;
+    }
+
 private:
+    server_node& server_;
     const configuration& config_;
 };
 
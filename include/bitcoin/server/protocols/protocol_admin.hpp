@@ -78,6 +78,8 @@ protected:
         uint8_t version, uint64_t filter) NOEXCEPT;
     bool handle_get_event_subscribe(const code& ec, interface::event_subscribe,
         uint8_t version, uint64_t filter) NOEXCEPT;
+    bool handle_get_subscriptions(const code& ec, interface::subscriptions,
+        uint8_t version) NOEXCEPT;
 
 protected:
     /// Notification event handlers (protocol strand).
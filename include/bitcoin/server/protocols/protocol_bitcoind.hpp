@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_HPP
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_HPP
 
+#include <atomic>
 #include <memory>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
@@ -28,11 +29,13 @@ namespace libbitcoin {
 namespace server {
 
 /// Common base for the bitcoind interface subgroup protocols, and the
-/// terminal default responder. Subgroup protocols carry their own interface
-/// dispatchers and are attached to the channel before this class, which is
-/// attached last. A subgroup claims each request it dispatches (via the
-/// channel latch), so default responses are sent here exactly once and only
-/// when no subgroup has claimed the request.
+/// terminal router and default responder. Subgroup protocols carry their own
+/// interface dispatchers and are attached to the channel before this class,
+/// which is attached last. Each subgroup sets its route on the channel router
+/// upon start, and this class validates each json-rpc request once and routes
+/// it to the owning subgroup (one lookup), responding itself only to requests
+/// of no subgroup. Requests claimed by a protocol attached earlier (via the
+/// channel latch, e.g. rest and btcd) are not routed.
 class BCS_API protocol_bitcoind
   : public server::protocol_http,
     protected network::tracker<protocol_bitcoind>
@@ -48,6 +51,7 @@ public:
         const options_t& options) NOEXCEPT
       : server::protocol_http(session, channel, options),
         network::tracker<protocol_bitcoind>(session->log),
+        router_(std::dynamic_pointer_cast<server::channel>(channel)->router()),
         p2kh_(session->server_settings().wallet.p2kh_prefix),
         p2sh_(session->server_settings().wallet.p2sh_prefix),
         witness_(session->server_settings().wallet.witness_prefix)
@@ -58,7 +62,8 @@ protected:
     using post = network::http::method::post;
     using options = network::http::method::options;
 
-    /// Terminal dispatch (unclaimed requests only).
+    /// Terminal routing (unclaimed requests only).
+    void stopping(const code& ec) NOEXCEPT override;
     void handle_receive_get(const code& ec,
         const network::http::method::get::cptr& get) NOEXCEPT override;
     void handle_receive_options(const code& ec,
@@ -71,6 +76,15 @@ protected:
     /// The method names reported by help (channel-registered on start).
     std::string help_names() const NOEXCEPT;
 
+    /// The merged method table of all subgroup interfaces (name to ordinal).
+    static const method_router::table& subgroup_methods() NOEXCEPT;
+
+    /// The channel json-rpc router (requires strand).
+    inline method_router& router() const NOEXCEPT
+    {
+        return router_;
+    }
+
     /// Serialize an object (chain::header, chain::transaction, ...) to a
     /// base16 string.
     template <typename Object, typename ...Args>
@@ -131,10 +145,37 @@ protected:
         const network::http::request_cptr& request) NOEXCEPT;
     void set_rpc_request(const network::rpc::request_t& message) NOEXCEPT;
 
+    /// Context of a response deferred to the parallel pool. The request
+    /// context is captured on the strand, as it does not survive subsequent
+    /// requests, and the result (or error data) is set off the strand.
+    struct deferred_t
+    {
+        uint64_t call{};
+        network::rpc::version version{};
+        network::rpc::id_option id{};
+        network::http::request_cptr request{};
+        network::rpc::value_option result{};
+        size_t size_hint{};
+    };
+
+    using deferred_ptr = std::shared_ptr<deferred_t>;
+
+    /// Register the call and capture the response context (requires strand).
+    /// Null if the server-wide bound on parallel calls is reached.
+    deferred_ptr defer(const std::string& method) NOEXCEPT;
+
+    /// Unregister the call, restore the response context and send the result,
+    /// or the error with result as its data (requires strand).
+    void complete_deferred(const code& ec,
+        const deferred_ptr& deferred) NOEXCEPT;
+
     /// Validate a transaction given next block context (node utility).
     code validate_tx(const system::chain::transaction& tx) const NOEXCEPT;
     code broadcast_tx(const system::chain::transaction::cptr& tx) NOEXCEPT;
 
+    /// Relay a validated transaction (the relay step of broadcast_tx).
+    void relay_tx(const system::chain::transaction::cptr& tx) NOEXCEPT;
+
 private:
     // Senders.
     void send_rpc(network::rpc::response_t&& model,
@@ -146,6 +187,7 @@ private:
     network::http::request_cptr reset_rpc_request() NOEXCEPT;
 
     // These are protected by strand.
+    method_router& router_;
     network::rpc::version version_{};
     network::rpc::id_option id_{};
 
@@ -154,6 +196,7 @@ protected:
     const uint8_t p2kh_;
     const uint8_t p2sh_;
     const std::string witness_;
+    std::atomic_bool stopping_{};
 };
 
 } // namespace server
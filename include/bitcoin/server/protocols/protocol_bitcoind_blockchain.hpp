@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_BLOCKCHAIN_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind_dispatch.hpp>
@@ -138,6 +140,21 @@ protected:
         rpc_interface::get_tx_spending_prevout) NOEXCEPT;
     bool handle_import_mempool(const code& ec,
         rpc_interface::import_mempool) NOEXCEPT;
+
+private:
+    // Deferred handlers (parallel pool).
+    void do_get_block(const system::hash_digest& hash,
+        const std::string& blockhash, size_t level,
+        const deferred_ptr& deferred) NOEXCEPT;
+    void do_get_block_stats(const database::header_link& link, size_t height,
+        const network::rpc::array_t& stats,
+        const deferred_ptr& deferred) NOEXCEPT;
+    void do_get_chain_tx_stats(const database::header_link& link,
+        size_t height, size_t window, const deferred_ptr& deferred) NOEXCEPT;
+    void do_get_tx_out_proof(
+        const std::unordered_set<system::hash_digest>& targets,
+        const system::hash_digest& block,
+        const deferred_ptr& deferred) NOEXCEPT;
 };
 
 } // namespace server
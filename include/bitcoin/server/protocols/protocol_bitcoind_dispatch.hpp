@@ -27,11 +27,13 @@ namespace libbitcoin {
 namespace server {
 
 /// Interface subgroup dispatch, the common shape of the bitcoind subgroup
-/// protocols. Carries the subgroup interface dispatcher and claims each
-/// request defined by the interface, silently deferring all others to the
-/// terminal responder (protocol_bitcoind, attached last). All subgroups are
-/// explicitly instantiated (with their dispatchers) in the implementation
-/// translation unit, isolating the dispatch metaprogramming there.
+/// protocols. Carries the subgroup interface dispatcher and sets its route on
+/// the channel router upon start, so that the terminal router
+/// (protocol_bitcoind, attached last) dispatches each validated request of
+/// the interface here.
+/// All subgroups are explicitly instantiated (with their dispatchers) in the
+/// implementation translation unit, isolating the dispatch metaprogramming
+/// there, including the merged method table of all subgroups.
 template <typename Interface>
 class protocol_bitcoind_dispatch
   : public protocol_bitcoind
@@ -39,7 +41,7 @@ class protocol_bitcoind_dispatch
 public:
     using rpc_dispatcher = network::rpc::dispatcher<Interface>;
 
-    /// Subscribe to the post and websocket transports of the interface.
+    /// Set the channel route of the interface.
     void start() NOEXCEPT override;
 
     void stopping(const code& ec) NOEXCEPT override;
@@ -52,13 +54,9 @@ protected:
     {
     }
 
-    /// The post transport of the interface subgroup.
-    void handle_receive_post(const code& ec,
-        const post::cptr& post) NOEXCEPT override;
-
-    /// The websocket transport of the interface subgroup.
-    void dispatch_websocket(
-        const network::http::request& request) NOEXCEPT override;
+    /// The route of the interface subgroup (request is null for websocket).
+    void dispatch(const network::rpc::request_t& message,
+        const network::http::request_cptr& request) NOEXCEPT;
 
     /// Subgroup handler wiring (dispatcher subscription).
     template <class Derived, typename Method, typename... Args>
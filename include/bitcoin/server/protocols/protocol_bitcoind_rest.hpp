@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_REST_HPP
 
 #include <memory>
+#include <string>
+#include <string_view>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -90,6 +92,12 @@ private:
         rest_dispatcher_.subscribe(BIND_SHARED(method, args));
     }
 
+    void send_string(std::string&& serialized,
+        network::http::media_type type) NOEXCEPT;
+    bool validate(std::string_view method, const system::hash_digest& hash,
+        const database::header_link& link, std::string_view params,
+        uint8_t media) NOEXCEPT;
+
     // This is protected by strand.
     rest_dispatcher rest_dispatcher_{};
 };
@@ -95,7 +95,15 @@ protected:
     bool handle_get_private_broadcast_info(const code& ec,
         rpc_interface::get_private_broadcast_info) NOEXCEPT;
     bool handle_submit_package(const code& ec,
-        rpc_interface::submit_package) NOEXCEPT;
+        rpc_interface::submit_package, const network::rpc::array_t& package,
+        double maxfeerate, double maxburnamount) NOEXCEPT;
+
+private:
+    // Deferred handlers (parallel pool).
+    void do_submit_package(const tx_package::ptr& package, size_t index,
+        const deferred_ptr& deferred) NOEXCEPT;
+    void complete_submit_package(const tx_package::ptr& package,
+        const deferred_ptr& deferred) NOEXCEPT;
 };
 
 } // namespace server
@@ -20,12 +20,11 @@
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BTCD_HPP
 
 #include <atomic>
-#include <map>
 #include <memory>
-#include <set>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind.hpp>
 
 namespace libbitcoin {
@@ -50,7 +49,6 @@ public:
       : server::protocol_bitcoind(session, channel, options),
         network::tracker<protocol_btcd>(session->log),
         options_(options),
-        turbo_(session->database_settings().turbo),
         notification_strand_(channel->service().get_executor())
     {
     }
@@ -135,20 +133,6 @@ protected:
     using header_cptr = system::chain::header::cptr;
     using hashes_ptr = std::shared_ptr<system::hashes>;
     using array_ptr = std::shared_ptr<network::rpc::array_t>;
-    using history = database::history;
-    using histories = database::histories;
-    using cursor_t = database::height_link;
-
-    struct address_watch final
-    {
-        cursor_t cursor{};
-    };
-
-    struct outpoint_watch final
-    {
-        database::history outpoint{};
-        database::histories spenders{};
-    };
 
     /// Completion handlers (for long-running or other async queries).
     /// -----------------------------------------------------------------------
@@ -159,7 +143,7 @@ protected:
 
     void do_rescan_blocks(const hashes_ptr& hashes) NOEXCEPT;
     void do_rescan_watches(const hashes_ptr& hashes,
-        const system::hashes& keys, system::chain::points& points) NOEXCEPT;
+        const scripthash_set& keys, const point_set& points) NOEXCEPT;
     void complete_rescan_blocks(const code& ec,
         const array_ptr& discovered) NOEXCEPT;
 
@@ -175,15 +159,12 @@ protected:
 
     /// Utilities.
     /// -----------------------------------------------------------------------
-    using matched_txs = std::map<size_t, hash_digest>;
-    using matches = std::map<size_t, matched_txs>;
-    using sizes = std::set<size_t>;
 
-    code match_addresses(matches& out, address_watch& sub,
-        const hash_digest& key, const sizes& heights) NOEXCEPT;
-    void match_outpoints(matches& out, outpoint_watch& sub,
-        const point& prevout, const sizes& heights) NOEXCEPT;
-    network::rpc::array_t serialize_matches(const matched_txs& txs) NOEXCEPT;
+    system::chain::transaction_cptrs match_block(
+        const database::header_link& link, const scripthash_set& keys,
+        const point_set& points) const NOEXCEPT;
+    static network::rpc::array_t serialize_matches(
+        const system::chain::transaction_cptrs& txs) NOEXCEPT;
 
 private:
     template <class Derived, typename Method, typename... Args>
@@ -202,8 +183,6 @@ private:
 
     // These are thread safe.
     const options_t& options_;
-    const bool turbo_;
-    std::atomic_bool stopping_{};
     std::atomic_bool subscribed_blocks_{};
 
     // This is protected by strand.
@@ -213,8 +192,8 @@ private:
     network::asio::strand notification_strand_;
 
     // These are protected by notification strand.
-    std::map<point, outpoint_watch> outpoint_watches_{};
-    std::map<hash_digest, address_watch> address_watches_{};
+    point_set outpoint_watches_{};
+    scripthash_set address_watches_{};
 };
 
 } // namespace server
@@ -19,13 +19,15 @@
 #ifndef LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_ELECTRUM_HPP
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_ELECTRUM_HPP
 
-#include <map>
 #include <memory>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
 #include <bitcoin/server/protocols/protocol_rpc.hpp>
+#include <bitcoin/server/services/fee_snapshot.hpp>
+#include <bitcoin/server/services/subscription_table.hpp>
+#include <bitcoin/server/services/subscription_usage.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -122,7 +124,7 @@ protected:
         const std::string& scripthash) NOEXCEPT;
     void handle_blockchain_scripthash_get_history(const code& ec,
         rpc_interface::blockchain_scripthash_get_history,
-        const std::string& scripthash) NOEXCEPT;
+        const std::string& scripthash, double from_height) NOEXCEPT;
     void handle_blockchain_scripthash_get_mempool(const code& ec,
         rpc_interface::blockchain_scripthash_get_mempool,
         const std::string& scripthash) NOEXCEPT;
@@ -135,6 +137,9 @@ protected:
     void handle_blockchain_scripthash_unsubscribe(const code& ec,
         rpc_interface::blockchain_scripthash_unsubscribe,
         const std::string& scripthash) NOEXCEPT;
+    void handle_blockchain_scripthash_subscribe_many(const code& ec,
+        rpc_interface::blockchain_scripthash_subscribe_many,
+        const interface::array_t& scripthashes) NOEXCEPT;
 
     /// Handlers (scriptpubkey).
     void handle_blockchain_scriptpubkey_get_balance(const code& ec,
@@ -206,19 +211,42 @@ protected:
     using history = database::history;
     using unspents = database::unspents;
     using histories = database::histories;
-    using cursor_t = database::height_link;
-    using midstate = system::accumulator<system::sha256>;
     enum class notify_t { address, scripthash, scriptpubkey };
 
-    // Subscription to address/scripthash/scruptpubkey.
+    // Subscription to address/scripthash/scruptpubkey. Accumulation state is
+    // shared by all subscribers to the scripthash (see scripthash_status).
     struct address_subscription final
     {
         notify_t type{};
-        cursor_t cursor{};
+
+        // The status most recently sent to this channel.
         hash_digest status{};
-        midstate accumulator{};
     };
 
+    // Initial subscription state computed on the threadpool.
+    struct pending_subscription final
+    {
+        hash_digest hash{};
+        address_subscription sub{};
+        code ec{};
+    };
+
+    // Subscription request of one or more keys, merged on notification strand.
+    struct subscription_batch final
+    {
+        notify_t type{};
+        bool many{};
+        std::vector<hash_digest> hashes{};
+        std::vector<pending_subscription> pending{};
+        std::atomic_size_t remaining{};
+        size_t notifications{};
+        size_t reorganizations{};
+    };
+    using subscription_batch_ptr = std::shared_ptr<subscription_batch>;
+
+    /// Most concurrent initial history queries of one subscription request.
+    static constexpr size_t maximum_subscription_tasks = 8;
+
     // Subscription to outpoint.
     struct outpoint_subscription final
     {
@@ -238,12 +266,12 @@ protected:
     /// -----------------------------------------------------------------------
 
     void get_balance(const hash_digest& hash) NOEXCEPT;
-    void get_history(const hash_digest& hash) NOEXCEPT;
+    void get_history(const hash_digest& hash, size_t from_height) NOEXCEPT;
     void get_mempool(const hash_digest& hash) NOEXCEPT;
     void list_unspent(const hash_digest& hash) NOEXCEPT;
 
     void do_get_balance(const hash_digest& hash) NOEXCEPT;
-    void do_get_history(const hash_digest& hash) NOEXCEPT;
+    void do_get_history(const hash_digest& hash, size_t from_height) NOEXCEPT;
     void do_get_mempool(const hash_digest& hash) NOEXCEPT;
     void do_list_unspent(const hash_digest& hash) NOEXCEPT;
 
@@ -255,32 +283,57 @@ protected:
     void handle_estimate_fee(const code& ec, uint64_t fee) NOEXCEPT;
     void complete_estimate_fee(const code& ec, uint64_t fee) NOEXCEPT;
 
+    void do_get_fee_histogram() NOEXCEPT;
+    void complete_get_fee_histogram(const fee_snapshot::bins_ptr& bins) NOEXCEPT;
+
+    void do_broadcast_package(const tx_package::ptr& package,
+        size_t index) NOEXCEPT;
+    void complete_broadcast_package(const tx_package::ptr& package) NOEXCEPT;
+
     /// Notification event handlers.
     /// -----------------------------------------------------------------------
 
     void do_height(node::header_t link) NOEXCEPT;
     void do_header(node::header_t link) NOEXCEPT;
     void do_outpoint(node::header_t link) NOEXCEPT;
+    void do_outpoint_all(node::header_t link) NOEXCEPT;
     void do_scripthash(node::header_t link) NOEXCEPT;
+    void do_scripthash_all(node::header_t link) NOEXCEPT;
     void do_reorganized(node::header_t link) NOEXCEPT;
 
+    /// Subscription tables.
+    /// -----------------------------------------------------------------------
+
+    void report_usage() NOEXCEPT;
+    void do_release_subscriptions(const code& ec) NOEXCEPT;
+
     /// Address.
     /// -----------------------------------------------------------------------
 
     void scripthash_subscribe(const hash_digest& hash,
         notify_t type) NOEXCEPT;
-    void do_scripthash_subscribe(const hash_digest& hash,
-        notify_t type) NOEXCEPT;
+    void scripthash_subscribe(const subscription_batch_ptr& batch) NOEXCEPT;
+    void do_scripthash_subscribe(const subscription_batch_ptr& batch) NOEXCEPT;
+    void parallel_scripthash_subscribe(
+        const subscription_batch_ptr& batch) NOEXCEPT;
+    void do_scripthash_histories(const subscription_batch_ptr& batch,
+        size_t first, size_t last) NOEXCEPT;
+    void merge_scripthash_subscribe(
+        const subscription_batch_ptr& batch) NOEXCEPT;
     void complete_scripthash_subscribe(const code& ec,
         const hash_digest& status) NOEXCEPT;
+    void complete_scripthash_subscribe_many(const code& ec,
+        const std::vector<hash_digest>& statuses) NOEXCEPT;
     void scripthash_unsubscribe(const hash_digest& hash) NOEXCEPT;
     void do_scripthash_unsubscribe(const hash_digest& hash) NOEXCEPT;
     void complete_scripthash_unsubscribe(bool found) NOEXCEPT;
     void scripthash_notify(const hash_digest& status, const hash_digest& hash,
         notify_t type) NOEXCEPT;
 
-    code get_scripthash_history(address_subscription& sub,
-        const hash_digest& hash, size_t limit) NOEXCEPT;
+    bool update_scripthash(address_subscription& sub,
+        const hash_digest& hash, const database::header_link& link) NOEXCEPT;
+    code get_scripthash_status(address_subscription& sub,
+        const hash_digest& hash, const database::header_link& link) NOEXCEPT;
 
     /// Outpoint.
     /// -----------------------------------------------------------------------
@@ -293,6 +346,8 @@ protected:
     void outpoint_notify(const std::unique_ptr<interface::object_t>& status,
         const point& prevout) NOEXCEPT;
 
+    void update_outpoint(outpoint_subscription& sub,
+        const point& prevout) NOEXCEPT;
     bool get_outpoint_history(outpoint_subscription& sub,
         const point& prevout) const NOEXCEPT;
 
@@ -327,8 +382,6 @@ private:
     // Transformations.
     static array_t transform(const unspents& unspents) NOEXCEPT;
     static array_t transform(const histories& histories) NOEXCEPT;
-    static void write_status(midstate& accumulator,
-        const history& history) NOEXCEPT;
     static bool is_valid_hint(const std::string& hint) NOEXCEPT;
     static std::string to_method_name(notify_t type) NOEXCEPT;
     static object_t to_outpoint_status(size_t output_height) NOEXCEPT;
@@ -354,6 +407,9 @@ private:
     code validate_tx(const system::chain::transaction& tx) const NOEXCEPT;
     code broadcast_tx(const system::chain::transaction::cptr& tx) NOEXCEPT;
 
+    // Relay a validated transaction (the relay step of broadcast_tx).
+    void relay_tx(const system::chain::transaction::cptr& tx) NOEXCEPT;
+
     // These are thread safe.
     const options_t& options_;
     const bool turbo_;
@@ -372,8 +428,14 @@ private:
     network::asio::strand notification_strand_;
 
     // These are protected by notification strand.
-    std::map<point, outpoint_subscription> outpoint_subscriptions_{};
-    std::map<hash_digest, address_subscription> address_subscriptions_{};
+    subscription_table<point, outpoint_subscription> outpoint_subscriptions_{};
+    subscription_table<hash_digest, address_subscription>
+        address_subscriptions_{};
+    subscription_usage::totals usage_{};
+    size_t reorganizations_{};
+    size_t notifications_{};
+    bool rescan_{};
+    bool rescan_outpoints_{};
 };
 
 } // namespace server
@@ -65,6 +65,9 @@ protected:
         const network::http::request& request={}) NOEXCEPT;
     virtual void send_chunk(system::data_chunk&& bytes,
         const network::http::request& request={}) NOEXCEPT;
+    virtual void send_string(std::string&& serialized,
+        network::http::media_type type,
+        const network::http::request& request={}) NOEXCEPT;
     virtual void send_file(network::http::file&& file,
         network::http::media_type type,
         const network::http::request& request={}) NOEXCEPT;
@@ -74,9 +77,28 @@ protected:
     virtual void send_buffer(network::http::buffer_body::value_type&& buffer,
         network::http::media_type type,
         const network::http::request& request={}) NOEXCEPT;
+    virtual void send_shared(const std::shared_ptr<const std::string>& bytes,
+        network::http::media_type type,
+        const network::http::request& request={}) NOEXCEPT;
+
+    /// Send shared bytes that are already encoded in the coding.
+    virtual void send_shared(const std::shared_ptr<const std::string>& bytes,
+        network::http::media_type type, content_coding coding,
+        const network::http::request& request={}) NOEXCEPT;
     virtual void send_empty(
         const network::http::request& request={}) NOEXCEPT;
 
+    /// Partial content senders (identity coded).
+    virtual void send_partial(const std::shared_ptr<const std::string>& bytes,
+        const byte_range& range, network::http::media_type type,
+        const network::http::request& request={}) NOEXCEPT;
+    virtual void send_partial(std::string&& part, const byte_range& range,
+        network::http::media_type type,
+        const network::http::request& request={}) NOEXCEPT;
+    virtual void send_file(network::http::file&& file,
+        network::http::media_type type, byte_range range,
+        const network::http::request& request={}) NOEXCEPT;
+
     /// Notifiers (websocket).
     virtual void notify_json(boost::json::value&& model, size_t size_hint,
         const network::http::request& request={}) NOEXCEPT;
@@ -94,6 +116,24 @@ protected:
         const std::string& target = "/") const NOEXCEPT;
 
 private:
+    using file_ptr = std::shared_ptr<network::http::file>;
+
+    // File ranges are read into memory, so each response is bounded.
+    static constexpr size_t maximum_file_range = 16u * 1024u * 1024u;
+
+    // File ranges are read off the strand.
+    void do_read_range(const file_ptr& file, network::http::media_type type,
+        const byte_range& range,
+        const network::http::request& request) NOEXCEPT;
+    void complete_read_range(const code& ec,
+        const std::shared_ptr<std::string>& part,
+        network::http::media_type type, const byte_range& range,
+        const network::http::request& request) NOEXCEPT;
+
+    // Retains shared body bytes until the write completes.
+    void handle_shared_complete(const code& ec,
+        const std::shared_ptr<const std::string>& bytes) NOEXCEPT;
+
     // This is thread safe.
     const options_t& options_;
 };
@@ -20,8 +20,12 @@
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_HTTP_HPP
 
 #include <memory>
+#include <string>
+#include <string_view>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/byte_range.hpp>
+#include <bitcoin/server/parsers/content_coding.hpp>
 #include <bitcoin/server/protocols/protocol.hpp>
 
 namespace libbitcoin {
@@ -57,9 +61,79 @@ protected:
     /// Obtain cached request and clear cache (requires strand).
     network::http::request_cptr reset_request() NOEXCEPT;
 
+    /// Conditional requests (http, requires strand).
+    /// -----------------------------------------------------------------------
+
+    /// Capture the If-None-Match, Accept-Encoding, Range and If-Range fields
+    /// of the dispatched request and clear any entity tag not sent with the
+    /// previous response.
+    void set_conditions(const network::http::request& request) NOEXCEPT;
+
+    /// True if the dispatched request lists the entity tag (If-None-Match),
+    /// or if it is "*" and the caller has established that the resource
+    /// exists (a wildcard must never revalidate a missing resource).
+    bool is_not_modified(const std::string& tag,
+        bool exists=false) const NOEXCEPT;
+
+    /// True if the block is confirmed at least immutable_depth deep.
+    bool is_immutable(const database::header_link& link) const NOEXCEPT;
+
+    /// Set the entity tag of the next response, cacheable as immutable.
+    void set_immutable(const std::string& tag) NOEXCEPT;
+
+    /// Add (and clear) the entity tag and immutable caching fields, if set.
+    /// The tag is weak if the response is content encoded (call after).
+    void add_validator_headers(network::http::response& response) NOEXCEPT;
+
+    /// Send not modified (304) with the entity tag and caching fields.
+    void send_not_modified(const std::string& tag,
+        const network::http::request& request={}) NOEXCEPT;
+
+    /// The requested range of a representation of the size, full if none,
+    /// websocket, or If-Range does not match the entity tag (call after
+    /// set_immutable, as If-Range requires a strong validator).
+    range_request get_range(byte_range& out, size_t size) NOEXCEPT;
+
+    /// Send range not satisfiable (416) for a representation of the size.
+    void send_range_not_satisfiable(size_t size,
+        const network::http::request& request={}) NOEXCEPT;
+
+    /// Send too many requests (429), a client limit such as subscriptions.
+    void send_too_many_requests(const code& reason,
+        const network::http::request& request={}) NOEXCEPT;
+
+    /// Content negotiation (http, requires strand).
+    /// -----------------------------------------------------------------------
+    /// Applied to html (native) and bitcoind REST responses. bitcoind json-rpc
+    /// responses are not compressed (see protocol_bitcoind::send_rpc).
+
+    /// The accepted coding for a body of the size, identity if none accepted,
+    /// websocket, or the body is smaller than minimum_compression.
+    content_coding encoding(size_t size) NOEXCEPT;
+
+    /// Compress the body to out in the accepted coding, which is returned
+    /// (identity if not compressed).
+    content_coding encode(std::string& out,
+        std::string_view body) NOEXCEPT;
+
+    /// Add the Vary field and the Content-Encoding field if not identity.
+    void add_encoding_headers(network::http::response& response,
+        content_coding coding) NOEXCEPT;
+
 private:
-    // This is protected by strand.
+    // Blocks at this depth are presumed never reorganized (coinbase maturity).
+    static constexpr size_t immutable_depth = 100;
+
+    // Smaller bodies are not worth the compression overhead (about a packet).
+    static constexpr size_t minimum_compression = 1400;
+
+    // These are protected by strand.
     network::http::request_cptr request_{};
+    std::string if_none_match_{};
+    std::string entity_tag_{};
+    std::string range_{};
+    std::string if_range_{};
+    content_coding encoding_{ content_coding::identity };
 };
 
 } // namespace server
@@ -22,10 +22,14 @@
 #include <atomic>
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_html.hpp>
+#include <bitcoin/server/services/response_cache.hpp>
+#include <bitcoin/server/services/subscription_table.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -185,6 +189,8 @@ protected:
     void do_top(node::header_t link, media_type media) NOEXCEPT;
     void do_block(node::header_t link, media_type media) NOEXCEPT;
     void do_transaction(node::transaction_t link, media_type media) NOEXCEPT;
+    void do_address(node::header_t link) NOEXCEPT;
+    void do_output(node::header_t link) NOEXCEPT;
 
 private:
     static constexpr uint8_t text = to_value(media_type::text_plain);
@@ -231,8 +237,10 @@ private:
         const system::hash_cptr& hash) NOEXCEPT;
     ////void do_get_address_unconfirmed(uint8_t media, bool turbo,
     ////    const system::hash_cptr& hash) NOEXCEPT;
-    void complete_get_address(const code& ec, uint8_t media,
+    static std::shared_ptr<const std::string> to_outpoints(uint8_t media,
         const database::outpoints& set) NOEXCEPT;
+    void complete_get_address(const code& ec, uint8_t media,
+        const std::shared_ptr<const std::string>& body) NOEXCEPT;
 
     void do_get_address_balance(uint8_t media, bool turbo,
         const system::hash_cptr& hash) NOEXCEPT;
@@ -242,6 +250,7 @@ private:
     // Utilities.
     // ------------------------------------------------------------------------
 
+    bool watches_full() const NOEXCEPT;
     size_t get_pruned_height() NOEXCEPT;
     size_t get_active_height(const system::hash_digest& hash) NOEXCEPT;
 
@@ -251,6 +260,26 @@ private:
     database::header_link to_header(const std::optional<uint32_t>& height,
         const std::optional<system::hash_cptr>& hash) NOEXCEPT;
 
+    bool revalidate(std::string_view method, const system::hash_digest& hash,
+        std::string_view params, uint8_t media) NOEXCEPT;
+    bool revalidate(std::string_view method,
+        const std::optional<system::hash_cptr>& hash,
+        std::string_view params, uint8_t media) NOEXCEPT;
+    bool validate(std::string_view method, const system::hash_digest& hash,
+        const database::header_link& block, std::string_view params,
+        uint8_t media) NOEXCEPT;
+    bool validate(std::string_view method, const database::header_link& link,
+        std::string_view params, uint8_t media) NOEXCEPT;
+
+    static std::string to_key(std::string_view method,
+        const database::header_link& link, bool witness,
+        uint8_t media) NOEXCEPT;
+    void send_cached(const response_cache::bytes_ptr& response,
+        const std::string& key, const database::header_link& link,
+        uint8_t media) NOEXCEPT;
+    bool get_block_range(std::string& out, const database::header_link& link,
+        const byte_range& range, bool witness) const NOEXCEPT;
+
     // These are thread safe, strand uses network threadpool.
     network::asio::strand notification_strand_;
     const bool turbo_;
@@ -263,14 +292,14 @@ private:
     std::atomic<media_type> block_subscribe_{ media_type::unknown };
     std::atomic<media_type> tx_subscribe_{ media_type::unknown };
 
-    // TODO: map of outpoints (notify on spenders).
+    // Conditional (any watched outpoints/scripthashes).
     std::atomic_bool output_subscribe_{};
-
-    // TODO: map of scripthashes (notify on instances).
     std::atomic_bool address_subscribe_{};
 
-    // This is protected by strand.
+    // These are protected by strand.
     dispatcher dispatcher_{};
+    subscription_table<system::chain::point, media_type> output_watches_{};
+    subscription_table<system::hash_digest, media_type> address_watches_{};
 };
 
 } // namespace server
@@ -127,8 +127,9 @@ server::protocol → node::protocol
 
 The bitcoind interface subgroups are independent protocols attached to the
 same channel (see sessions.hpp), each carrying its own interface dispatcher.
-A subgroup claims each request its interface defines; protocol_bitcoind is
-concrete and attached last, sending default responses (e.g. unknown method)
-only when no subgroup has claimed the request.
+A subgroup sets its route on the channel router; protocol_bitcoind is concrete
+and attached last, validating each request once and routing it by a merged
+method table, sending default responses (e.g. unknown method) only when no
+subgroup defines the method.
 
 */
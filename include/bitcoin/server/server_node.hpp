@@ -21,6 +21,7 @@
 
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/services/services.hpp>
 #include <bitcoin/server/sessions/sessions.hpp>
 
 namespace libbitcoin {
@@ -64,6 +65,42 @@ public:
     ////const node::settings& node_settings() const NOEXCEPT override;
     virtual const server::settings& server_settings() const NOEXCEPT;
 
+    /// Services (shared by all channels).
+    /// -----------------------------------------------------------------------
+
+    /// Inverted index of electrum scripthash subscriptions.
+    scripthash_index& scripthashes() NOEXCEPT;
+
+    /// Reference counted electrum scripthash status (shared midstates).
+    scripthash_status& statuses() NOEXCEPT;
+
+    /// Inverted index of electrum outpoint subscriptions.
+    outpoint_index& outpoints() NOEXCEPT;
+
+    /// LRU cache of block merkle trees (tx proofs).
+    merkle_cache& merkles() NOEXCEPT;
+
+    /// Incremental merkle tree of confirmed headers (checkpoint proofs).
+    header_merkle& headers() NOEXCEPT;
+
+    /// Bounded registry of json-rpc calls on the parallel pool.
+    rpc_calls& calls() NOEXCEPT;
+
+    /// LRU cache of serialized block query responses (byte budget).
+    response_cache& responses() NOEXCEPT;
+
+    /// Fee histogram of the confirmed top block (electrum).
+    fee_snapshot& fees() NOEXCEPT;
+
+    /// Header notice of the most recently organized block (electrum).
+    header_snapshot& notices() NOEXCEPT;
+
+    /// Next block chain state over the confirmed top (validation, mining).
+    chain_snapshot& states() NOEXCEPT;
+
+    /// Totals of channel subscription tables (admin diagnostics).
+    subscription_usage& usage() NOEXCEPT;
+
 protected:
     /// Session attachments.
     /// -----------------------------------------------------------------------
@@ -82,6 +119,9 @@ protected:
     void do_run(const result_handler& handler) NOEXCEPT override;
 
 private:
+    bool handle_event(const code& ec, node::chase event_,
+        node::event_value value) NOEXCEPT;
+
     void start_admin(const code& ec, const result_handler& handler) NOEXCEPT;
     void start_native(const code& ec, const result_handler& handler) NOEXCEPT;
     void start_bitcoind(const code& ec, const result_handler& handler) NOEXCEPT;
@@ -92,6 +132,19 @@ private:
 
     // This is thread safe.
     const configuration& config_;
+
+    // These are thread safe.
+    scripthash_index scripthashes_{};
+    scripthash_status statuses_{};
+    outpoint_index outpoints_{};
+    merkle_cache merkles_{};
+    header_merkle headers_{};
+    rpc_calls calls_{};
+    response_cache responses_;
+    fee_snapshot fees_{};
+    header_snapshot notices_{};
+    chain_snapshot states_{};
+    subscription_usage usage_{};
 };
 
 } // namespace server
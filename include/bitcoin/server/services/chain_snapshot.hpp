@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_CHAIN_SNAPSHOT_HPP
+#define LIBBITCOIN_SERVER_SERVICES_CHAIN_SNAPSHOT_HPP
+
+#include <memory>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide snapshot of the next block chain state, over the confirmed
+/// top. This is the context in which a pool tx would confirm and carries the
+/// next work required. It is computed once per top block (by the first
+/// request to observe it) and otherwise served to all channels at constant
+/// cost. The snapshot is keyed by the top header link, so it is replaced
+/// upon organization or reorganization.
+class BCS_API chain_snapshot
+{
+public:
+    struct next
+    {
+        /// The confirmed top header.
+        node::header_t link{};
+
+        /// The chain state of the block above it.
+        std::shared_ptr<const system::chain::chain_state> state{};
+    };
+
+    using next_ptr = std::shared_ptr<const next>;
+    DELETE_COPY_MOVE(chain_snapshot);
+
+    chain_snapshot() = default;
+
+    /// The next block state, null if the store is not consistent.
+    next_ptr get(const node::query& query,
+        const system::settings& settings) NOEXCEPT;
+
+private:
+    // These are protected by mutex.
+    next_ptr next_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_FEE_SNAPSHOT_HPP
+#define LIBBITCOIN_SERVER_SERVICES_FEE_SNAPSHOT_HPP
+
+#include <memory>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/fee_histogram.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide snapshot of the electrum fee histogram. There is no tx pool,
+/// so the histogram is simulated from the fees of the confirmed top block.
+/// It is computed once per top block (by the first request to observe it)
+/// and otherwise served to all channels at constant cost. The snapshot is
+/// keyed by the top header link, so it is replaced upon reorganization.
+class BCS_API fee_snapshot
+{
+public:
+    using bins_ptr = std::shared_ptr<const fee_bins>;
+    DELETE_COPY_MOVE(fee_snapshot);
+
+    fee_snapshot() = default;
+
+    /// The histogram of the confirmed top block, null if the store is not
+    /// consistent (block or prevouts missing).
+    bins_ptr get(const node::query& query) NOEXCEPT;
+
+private:
+    // These are protected by mutex.
+    node::header_t link_{};
+    bins_ptr bins_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
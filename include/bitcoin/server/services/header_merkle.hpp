@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_HEADER_MERKLE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_HEADER_MERKLE_HPP
+
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide incremental merkle tree over confirmed header hashes, for the
+/// electrum cp_height (checkpoint) proofs. Each complete interior node is
+/// hashed once, as its confirmed leaves are appended, so that a proof over
+/// any checkpoint prefix hashes only its partial right edge (log n). Leaves
+/// are appended as checkpoints are requested (not beyond the checkpoint) and
+/// truncated to the branch point of a reorganization.
+class BCS_API header_merkle
+{
+public:
+    DELETE_COPY_MOVE(header_merkle);
+
+    header_merkle() = default;
+
+    /// The merkle root of confirmed headers [0..waypoint] and the branch of
+    /// the header at target within it, as query.get_merkle_root_and_proof.
+    /// Requires target <= waypoint, error::not_found if above confirmed top.
+    code get_root_and_proof(system::hash_digest& root, system::hashes& proof,
+        const node::query& query, size_t target,
+        size_t waypoint) NOEXCEPT;
+
+    /// Truncate leaves above the reorganization branch point.
+    void reorganized(size_t branch_height) NOEXCEPT;
+
+    /// The number of accumulated leaves (confirmed header hashes).
+    size_t size() const NOEXCEPT;
+
+private:
+    using levels = std::vector<system::hashes>;
+
+    // Requires unique lock.
+    bool synchronize(const node::query& query, size_t count) NOEXCEPT;
+    void push(const system::hash_digest& leaf) NOEXCEPT;
+    void truncate(size_t count) NOEXCEPT;
+
+    // Requires shared lock.
+    bool is_current(const node::query& query, size_t count) const NOEXCEPT;
+    void prove(system::hash_digest& root, system::hashes& proof,
+        size_t target, size_t count) const NOEXCEPT;
+
+    // These are protected by mutex (complete nodes only, leaves at front).
+    levels levels_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
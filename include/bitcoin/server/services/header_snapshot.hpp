@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_HEADER_SNAPSHOT_HPP
+#define LIBBITCOIN_SERVER_SERVICES_HEADER_SNAPSHOT_HPP
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide snapshot of the most recently notified header. Header and
+/// height notifications of an organized block are read from the store and
+/// hex encoded once (by the first channel to observe it), and otherwise
+/// served to all subscribed channels at constant cost. A header link is
+/// immutable, so the snapshot is simply replaced by the next link.
+class BCS_API header_snapshot
+{
+public:
+    struct notice
+    {
+        size_t height{};
+        std::string hex{};
+    };
+
+    using notice_ptr = std::shared_ptr<const notice>;
+    DELETE_COPY_MOVE(header_snapshot);
+
+    header_snapshot() = default;
+
+    /// The notice of the header, null if the header is not found.
+    notice_ptr get(const node::query& query,
+        const node::header_t& link) NOEXCEPT;
+
+private:
+    // These are protected by mutex.
+    node::header_t link_{};
+    notice_ptr notice_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
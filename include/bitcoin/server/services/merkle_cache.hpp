@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_MERKLE_CACHE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_MERKLE_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/partial_merkle.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide LRU cache of fully materialized block merkle trees, keyed by
+/// header link. Proofs for many txs of the same (usually recent) blocks are
+/// then obtained by indexing the cached levels, not by rehashing the tree.
+/// A header link identifies a block, not a height, so a cached tree cannot
+/// be served for a block reorganized into its height. The trees of blocks
+/// reorganized out are also evicted so as not to displace live entries.
+class BCS_API merkle_cache
+{
+public:
+    using levels_ptr = std::shared_ptr<const merkle_levels>;
+    DELETE_COPY_MOVE(merkle_cache);
+
+    /// Bounds the cache (wallet sync is concentrated on recent blocks).
+    static constexpr size_t default_blocks = 64;
+
+    /// Cache the trees of up to the number of blocks (at least one).
+    merkle_cache(size_t blocks=default_blocks) NOEXCEPT;
+
+    /// The merkle levels of the block, computed and cached upon miss.
+    /// Null if the block is not found or its txs are not associated.
+    levels_ptr get(const node::query& query,
+        const database::header_link& link) NOEXCEPT;
+
+    /// Evict the trees of blocks above the reorganization branch point.
+    void reorganized(size_t branch_height) NOEXCEPT;
+
+    /// The number of cached block trees.
+    size_t size() const NOEXCEPT;
+
+private:
+    struct entry
+    {
+        node::header_t link;
+        size_t height;
+        levels_ptr levels;
+    };
+
+    using entries = std::list<entry>;
+
+    // This is thread safe.
+    const size_t blocks_;
+
+    // These are protected by mutex (most recently used at front).
+    entries entries_{};
+    std::unordered_map<node::header_t, entries::iterator> index_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_RESPONSE_CACHE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_RESPONSE_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide LRU cache of serialized responses to queries that are pure
+/// functions of a confirmed block (block, header, block statistics), bounded
+/// by a byte budget. Each response is associated with its block (link and
+/// height) and is served only while that block remains confirmed at its
+/// height, so a response cannot outlive a reorganization of its block, even
+/// if not yet evicted. Responses of blocks reorganized out are also evicted
+/// so as not to displace live entries. Deep history is otherwise retained
+/// until displaced within the budget. Compressed variants of a response are
+/// cached as distinct responses of the same block.
+class BCS_API response_cache
+{
+public:
+    using bytes_ptr = std::shared_ptr<const std::string>;
+    DELETE_COPY_MOVE(response_cache);
+
+    /// A zero budget disables the cache.
+    response_cache(size_t megabytes) NOEXCEPT;
+
+    /// The response key (interface, method, normalized params, media type).
+    static std::string key(std::string_view interface,
+        std::string_view method, std::string_view params,
+        std::string_view media) NOEXCEPT;
+
+    /// The cached response, null if not cached or its block is no longer
+    /// confirmed at its height.
+    bytes_ptr get(const node::query& query,
+        const std::string& key) NOEXCEPT;
+
+    /// Cache the response of the block, which is returned. The response is
+    /// not cached if the block is not confirmed or it exceeds the budget.
+    bytes_ptr put(const node::query& query, const std::string& key,
+        const database::header_link& link, std::string&& response) NOEXCEPT;
+
+    /// Evict the responses of blocks above the reorganization branch point.
+    void reorganized(size_t branch_height) NOEXCEPT;
+
+    /// The number of cached bytes (responses and keys).
+    size_t size() const NOEXCEPT;
+
+private:
+    struct entry
+    {
+        std::string key;
+        node::header_t link;
+        size_t height;
+        bytes_ptr response;
+    };
+
+    using entries = std::list<entry>;
+
+    static size_t footprint(const entry& entry) NOEXCEPT;
+    static bool is_confirmed(const node::query& query, node::header_t link,
+        size_t height) NOEXCEPT;
+
+    // Requires lock.
+    entries::iterator erase(entries::iterator it) NOEXCEPT;
+
+    // This is thread safe.
+    const size_t budget_;
+
+    // These are protected by mutex (most recently used at front).
+    size_t size_{};
+    entries entries_{};
+    std::unordered_map<std::string_view, entries::iterator> index_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
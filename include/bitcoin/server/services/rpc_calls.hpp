@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_RPC_CALLS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_RPC_CALLS_HPP
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide registry of json-rpc calls executing on the parallel pool
+/// (off the channel strand). The number of such calls is bounded, so that
+/// expensive queries cannot occupy the pool to the exclusion of other work
+/// (as the bitcoind rpc work queue). Calls in flight are reported by the
+/// getrpcinfo method.
+class BCS_API rpc_calls
+{
+public:
+    using clock = std::chrono::steady_clock;
+    DELETE_COPY_MOVE(rpc_calls);
+
+    struct call
+    {
+        std::string method;
+        clock::time_point start;
+    };
+
+    using calls = std::vector<call>;
+
+    /// The maximum number of calls in flight (bitcoind rpcworkqueue).
+    static constexpr size_t maximum_calls = 16;
+
+    rpc_calls() = default;
+
+    /// Register a call, zero if the maximum number of calls is in flight.
+    uint64_t begin(const std::string& method) NOEXCEPT;
+
+    /// Unregister a call (zero is ignored).
+    void end(uint64_t identifier) NOEXCEPT;
+
+    /// The calls in flight, in order of registration.
+    calls active() const NOEXCEPT;
+
+    /// The number of calls in flight.
+    size_t size() const NOEXCEPT;
+
+private:
+    // These are protected by mutex.
+    uint64_t next_{};
+    std::map<uint64_t, call> calls_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
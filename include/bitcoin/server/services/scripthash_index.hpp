@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SCRIPTHASH_INDEX_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SCRIPTHASH_INDEX_HPP
+
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/block_touched.hpp>
+#include <bitcoin/server/services/subscription_index.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide inverted index of electrum scripthash subscriptions. The
+/// scripthashes touched by an organized block are its output and spent
+/// prevout scripts.
+class BCS_API scripthash_index
+  : public subscription_index<system::hash_digest>
+{
+public:
+    using base = subscription_index<system::hash_digest>;
+    using base::touched;
+
+    /// The subscribed scripthashes of the channel touched by the block. The
+    /// block is read and intersected with the index only once, by the first
+    /// channel to request it. Error implies block or prevouts not found.
+    code touched(keys& out, const node::query& query,
+        const database::header_link& link, uint64_t channel) NOEXCEPT;
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SCRIPTHASH_STATUS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SCRIPTHASH_STATUS_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide, reference counted cache of electrum scripthash status, shared
+/// by all channels subscribed to the scripthash. Each entry retains the
+/// confirmed history midstate as of its (height) cursor, and so is advanced
+/// only by history above the cursor. For an organized block the status is
+/// computed by the first subscriber to request it and reused by the others.
+/// The entry is evicted when its last subscriber unsubscribes.
+class BCS_API scripthash_status
+{
+public:
+    DELETE_COPY_MOVE(scripthash_status);
+
+    /// Most recent checkpoints retained by each entry.
+    static constexpr size_t maximum_checkpoints = 4;
+
+    scripthash_status() = default;
+
+    /// Subscriptions.
+    /// -----------------------------------------------------------------------
+
+    /// Add a subscriber to the scripthash and obtain its current status
+    /// (null_hash if no history). The subscriber is not added on error.
+    code subscribe(system::hash_digest& out, const node::query& query,
+        const std::atomic_bool& cancel, const system::hash_digest& key,
+        size_t limit, bool turbo) NOEXCEPT;
+
+    /// Remove a subscriber from the scripthash (evicted at zero subscribers).
+    void unsubscribe(const system::hash_digest& key) NOEXCEPT;
+
+    /// The number of cached scripthashes.
+    size_t size() const NOEXCEPT;
+
+    /// Bytes of cached entries, including their checkpoint vectors and index
+    /// nodes (excludes allocator overhead).
+    size_t memory() const NOEXCEPT;
+
+    /// Status.
+    /// -----------------------------------------------------------------------
+
+    /// Update and obtain the status of a subscribed scripthash. A non-terminal
+    /// (organized block) link is computed once, later requests for the same
+    /// link return the cached status. A terminal link always updates.
+    code status(system::hash_digest& out, const node::query& query,
+        const std::atomic_bool& cancel, const system::hash_digest& key,
+        const database::header_link& link, size_t limit,
+        bool turbo) NOEXCEPT;
+
+    /// Rewind each entry to its latest checkpoint at or below the branch
+    /// point (idempotent across channels).
+    void reorganized(size_t branch_height) NOEXCEPT;
+
+    /// Rewind each entry to its initial state (unknown branch point).
+    void reset() NOEXCEPT;
+
+private:
+    using midstate = system::accumulator<system::sha256>;
+    using cursor_t = database::height_link;
+
+    // Confirmed accumulation state as of the (confirmed height) cursor.
+    struct checkpoint
+    {
+        cursor_t cursor{};
+        midstate accumulator{};
+    };
+
+    // Subscribers are protected by the table mutex, state by the entry mutex.
+    struct entry
+    {
+        size_t subscribers{};
+        database::header_link link{};
+        cursor_t cursor{};
+        midstate accumulator{};
+        system::hash_digest status{};
+        std::vector<checkpoint> checkpoints{};
+
+        // False while the accumulator is at its initial (IV) state.
+        bool folded{};
+        std::mutex mutex{};
+    };
+
+    using entry_ptr = std::shared_ptr<entry>;
+
+    static code update(entry& item, const node::query& query,
+        const std::atomic_bool& cancel, const system::hash_digest& key,
+        size_t limit, bool turbo) NOEXCEPT;
+    static void write_status(midstate& accumulator,
+        const database::history& history) NOEXCEPT;
+    static void save_checkpoint(entry& item) NOEXCEPT;
+    static void rewind_checkpoint(entry& item, size_t branch_height) NOEXCEPT;
+
+    entry_ptr find(const system::hash_digest& key) const NOEXCEPT;
+    std::vector<entry_ptr> entries() const NOEXCEPT;
+
+    // These are protected by mutex.
+    std::unordered_map<system::hash_digest, entry_ptr> entries_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
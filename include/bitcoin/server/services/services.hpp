@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SERVICES_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SERVICES_HPP
+
+#include <bitcoin/server/services/chain_snapshot.hpp>
+#include <bitcoin/server/services/fee_snapshot.hpp>
+#include <bitcoin/server/services/header_merkle.hpp>
+#include <bitcoin/server/services/header_snapshot.hpp>
+#include <bitcoin/server/services/merkle_cache.hpp>
+#include <bitcoin/server/services/outpoint_index.hpp>
+#include <bitcoin/server/services/response_cache.hpp>
+#include <bitcoin/server/services/rpc_calls.hpp>
+#include <bitcoin/server/services/scripthash_index.hpp>
+#include <bitcoin/server/services/scripthash_status.hpp>
+#include <bitcoin/server/services/subscription_index.hpp>
+#include <bitcoin/server/services/subscription_table.hpp>
+#include <bitcoin/server/services/subscription_usage.hpp>
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_INDEX_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_INDEX_HPP
+
+#include <deque>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide inverted index of subscriptions, mapping each subscribed key
+/// to its subscribing channels. The keys touched by an organized block are
+/// intersected with the index once per block, so that each channel obtains
+/// only its own touched subscriptions (usually none). Derived indexes compute
+/// the touched set of a block.
+template <typename Key>
+class subscription_index
+{
+public:
+    using key_type = Key;
+    using keys = std::vector<Key>;
+    using key_set = std::unordered_set<Key>;
+    DELETE_COPY_MOVE(subscription_index);
+
+    subscription_index() = default;
+
+    /// Subscriptions.
+    /// -----------------------------------------------------------------------
+
+    /// Add subscription of the channel to the key.
+    void subscribe(uint64_t channel, const Key& key) NOEXCEPT;
+
+    /// Remove subscription of the channel to the key.
+    void unsubscribe(uint64_t channel, const Key& key) NOEXCEPT;
+
+    /// Remove all subscriptions of the channel.
+    void unsubscribe(uint64_t channel) NOEXCEPT;
+
+    /// The number of distinct subscribed keys.
+    size_t size() const NOEXCEPT;
+
+    /// Notification.
+    /// -----------------------------------------------------------------------
+
+    /// The subscribed keys of the channel within the touched set.
+    /// Intersects the touched set with the index for the link if not cached.
+    void touched(keys& out, const database::header_link& link,
+        const key_set& set, uint64_t channel) NOEXCEPT;
+
+protected:
+    /// The cached subscribed keys of the channel for the link, false if the
+    /// link has not been intersected.
+    bool find(keys& out, const database::header_link& link,
+        uint64_t channel) const NOEXCEPT;
+
+private:
+    using channel_set = std::unordered_set<uint64_t>;
+    using woken = std::unordered_map<uint64_t, keys>;
+    using entry = std::pair<database::header_link, woken>;
+
+    // Bounds the per-block intersection cache (channels may lag by blocks).
+    static constexpr size_t recent_blocks = 8;
+
+    void intersect(const database::header_link& link,
+        const key_set& set) NOEXCEPT;
+
+    // These are protected by mutex.
+    std::unordered_map<Key, channel_set> index_{};
+    std::unordered_map<uint64_t, key_set> subscriptions_{};
+    std::deque<entry> recent_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#include <bitcoin/server/impl/services/subscription_index.ipp>
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_TABLE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_TABLE_HPP
+
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Not thread safe.
+/// Open addressing (linear probing) table of channel subscriptions. Entries
+/// are stored inline in one contiguous slot array, so that there is no heap
+/// node per entry, lookups probe adjacent memory, and all entries are freed
+/// in bulk by release(). Capacity is a power of two, doubled at 3/4 load.
+/// Erase shifts the following probe run back (no tombstones), invalidating
+/// iterators. Key and Value must be default constructible and movable.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class subscription_table
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+
+    template <typename Table, typename Slot>
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = subscription_table::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Slot*;
+        using reference = Slot&;
+
+        basic_iterator() = default;
+        basic_iterator(Table* table, size_t index) NOEXCEPT;
+
+        reference operator*() const NOEXCEPT;
+        pointer operator->() const NOEXCEPT;
+        basic_iterator& operator++() NOEXCEPT;
+        basic_iterator operator++(int) NOEXCEPT;
+        bool operator==(const basic_iterator& other) const NOEXCEPT;
+
+    private:
+        friend class subscription_table;
+        void skip() NOEXCEPT;
+
+        Table* table_{};
+        size_t index_{};
+    };
+
+    using iterator = basic_iterator<subscription_table, value_type>;
+    using const_iterator = basic_iterator<const subscription_table,
+        const value_type>;
+
+    subscription_table() = default;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    /// The number of entries.
+    size_t size() const NOEXCEPT;
+
+    /// True if there are no entries.
+    bool empty() const NOEXCEPT;
+
+    /// The number of slots (zero or a power of two).
+    size_t capacity() const NOEXCEPT;
+
+    /// Bytes of slot storage (excludes any heap owned by entries).
+    size_t memory() const NOEXCEPT;
+
+    /// Iteration (unordered).
+    /// -----------------------------------------------------------------------
+
+    iterator begin() NOEXCEPT;
+    iterator end() NOEXCEPT;
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+
+    /// Lookup.
+    /// -----------------------------------------------------------------------
+
+    iterator find(const Key& key) NOEXCEPT;
+    const_iterator find(const Key& key) const NOEXCEPT;
+    bool contains(const Key& key) const NOEXCEPT;
+
+    /// Mutation.
+    /// -----------------------------------------------------------------------
+
+    /// Insert the entry if the key is not found, as std::map::try_emplace.
+    std::pair<iterator, bool> try_emplace(const Key& key,
+        Value&& value) NOEXCEPT;
+    std::pair<iterator, bool> try_emplace(const Key& key,
+        const Value& value) NOEXCEPT;
+
+    /// Remove the entry of the key, returns the number removed (0 or 1).
+    size_t erase(const Key& key) NOEXCEPT;
+
+    /// Remove the entry at the iterator.
+    void erase(const iterator& it) NOEXCEPT;
+
+    /// Remove all entries and free the slot storage.
+    void release() NOEXCEPT;
+
+private:
+    static constexpr size_t minimum_capacity = 16;
+
+    size_t home(const Key& key) const NOEXCEPT;
+    size_t next(size_t index) const NOEXCEPT;
+    size_t locate(const Key& key) const NOEXCEPT;
+    void erase_at(size_t index) NOEXCEPT;
+    void reserve_one() NOEXCEPT;
+
+    std::vector<value_type> slots_{};
+    std::vector<bool> used_{};
+    size_t size_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#include <bitcoin/server/impl/services/subscription_table.ipp>
+
+#endif
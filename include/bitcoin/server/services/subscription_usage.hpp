@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_USAGE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SUBSCRIPTION_USAGE_HPP
+
+#include <atomic>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe.
+/// Server-wide totals of channel subscription tables, as reported by each
+/// channel on change of its own tables (and retracted when it stops). Bytes
+/// include table slots and heap owned by entries. The admin interface adds
+/// shared address status to the totals and reports memory per subscription.
+class BCS_API subscription_usage
+{
+public:
+    DELETE_COPY_MOVE(subscription_usage);
+
+    struct totals
+    {
+        size_t subscriptions;
+        size_t bytes;
+    };
+
+    subscription_usage() = default;
+
+    /// Replace the prior contribution of a channel with its current one.
+    void update(const totals& prior, const totals& current) NOEXCEPT;
+
+    /// Current totals (the two are not read atomically as a pair).
+    totals get() const NOEXCEPT;
+
+private:
+    // These are thread safe.
+    std::atomic_size_t subscriptions_{};
+    std::atomic_size_t bytes_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -39,11 +39,17 @@ public:
 
     /// Construct an instance (network should be started).
     inline session(server_node& node, const configuration& config) NOEXCEPT
-      : node::session((node::full_node&)node), config_(config),
-        network::tracker<session>((network::net&)node)
+      : node::session((node::full_node&)node), server_(node),
+        config_(config), network::tracker<session>((network::net&)node)
     {
     }
 
+    /// The server node (services shared across channels).
+    inline server_node& server() const NOEXCEPT
+    {
+        return server_;
+    }
+
     /// Configuration settings for all server libraries.
     inline const configuration& server_config() const NOEXCEPT
     {
@@ -57,7 +63,8 @@ public:
     }
 
 private:
-    // This is thread safe.
+    // These are thread safe.
+    server_node& server_;
     const configuration& config_;
 };
 
@@ -99,8 +99,9 @@ server::session → node::session
 The bitcoind interface subgroups (blockchain, control, mining, network,
 notifications, test, transaction, utility, wallet) are independent protocols,
 each with its own interface dispatcher, attached to the same channel. A
-subgroup claims each request defined by its interface (via the channel latch);
-protocol_bitcoind is the terminal default responder, attached last, replying
-only to unclaimed requests. The first protocol supplies channel_t/options_t.
+subgroup sets its route on the channel router upon start; protocol_bitcoind is
+the terminal router and default responder, attached last, routing each request
+to its owning subgroup (one lookup) and replying to requests of no subgroup.
+The first protocol supplies channel_t/options_t.
 
 */
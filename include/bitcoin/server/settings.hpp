@@ -151,6 +151,10 @@ public:
         /// Default page for default URL (recommended).
         std::string default_{ "index.html" };
 
+        /// Maximum cumulative number of websocket address and output
+        /// subscriptions per channel.
+        uint32_t maximum_subscriptions{ 1'000'000 };
+
         /// !path.empty() && http_server::enabled() [hidden, not virtual]
         virtual bool enabled() const NOEXCEPT;
     };
@@ -190,9 +194,6 @@ public:
 
         /// Maximum cumulative number of loadtxfilter watches per channel.
         uint32_t maximum_filters{ 1'000'000 };
-
-        /// Maximum number of address history entries upon one index walk.
-        uint32_t maximum_history{ 1'000'000 };
     };
 
     // html_server precludes copy.
@@ -201,6 +202,9 @@ public:
     settings(system::chain::selection context, const embedded_pages& native,
         const embedded_pages& admin) NOEXCEPT;
 
+    /// Megabytes of serialized block query responses cached (zero disables).
+    uint32_t response_cache{ 64 };
+
     /// address encoding (coin/network identity)
     wallet_settings wallet;
 
@@ -884,6 +884,13 @@ options_metadata parser::load_settings() THROWS
         "The socks5 proxy endpoint (port required)."
     )
 
+    /* [server] */
+    (
+        "server.response_cache",
+        value<uint32_t>(&configured.server.response_cache),
+        "The megabytes of block query responses cached, defaults to '64' (zero disables)."
+    )
+
     /* [wallet] */
     (
         "wallet.p2kh_prefix",
@@ -1089,6 +1096,11 @@ options_metadata parser::load_settings() THROWS
         value<bool>(&configured.server.native.websocket),
         "Enable websocket interface, defaults to true."
     )
+    (
+        "native.maximum_subscriptions",
+        value<uint32_t>(&configured.server.native.maximum_subscriptions),
+        "The maximum allowed websocket address and output subscriptions per channel, defaults to '1000000'."
+    )
 
     /* [bitcoind] */
     (
@@ -1263,11 +1275,6 @@ options_metadata parser::load_settings() THROWS
         value<uint32_t>(&configured.server.btcd.maximum_filters),
         "The maximum number of loadtxfilter watches, defaults to '1000000'."
     )
-    (
-        "btcd.maximum_history",
-        value<uint32_t>(&configured.server.btcd.maximum_history),
-        "The maximum number of address history entries, defaults to '1000000'."
-    )
     (
         "btcd.host",
         value<network::config::endpoints>(&configured.server.btcd.hosts),
@@ -92,6 +92,10 @@ code admin_target(request_t& out, const std::string_view& path) NOEXCEPT
         else
             return error::invalid_subcomponent;
     }
+    else if (target == "subscriptions")
+    {
+        method = "subscriptions";
+    }
     else
     {
         return error::invalid_target;
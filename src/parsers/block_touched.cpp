@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/block_touched.hpp>
+
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+void touched_scripthashes(scripthash_set& out,
+    const chain::block& block) NOEXCEPT
+{
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        for (const auto& output: *tx->outputs_ptr())
+            out.insert(output->script().hash());
+
+        // Coinbase inputs have no prevout (and prevouts may be unpopulated).
+        if (!tx->is_coinbase())
+            for (const auto& in: *tx->inputs_ptr())
+                if (in->prevout)
+                    out.insert(in->prevout->script().hash());
+    }
+}
+
+void touched_outpoints(point_set& out, const chain::block& block) NOEXCEPT
+{
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        const auto hash = tx->hash(false);
+        const auto outputs = tx->outputs_ptr()->size();
+        for (uint32_t index{}; index < outputs; ++index)
+            out.emplace(hash, index);
+
+        // Coinbase inputs spend the null point.
+        if (!tx->is_coinbase())
+            for (const auto& in: *tx->inputs_ptr())
+                out.insert(in->point());
+    }
+}
+
+void touched_address(database::outpoints& out, const chain::block& block,
+    const hash_digest& scripthash) NOEXCEPT
+{
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        const auto hash = tx->hash(false);
+        const auto& outputs = *tx->outputs_ptr();
+        for (uint32_t index{}; index < outputs.size(); ++index)
+        {
+            const auto& output = outputs.at(index);
+            if (output->script().hash() == scripthash)
+                out.emplace(chain::point{ hash, index }, output->value());
+        }
+
+        // Coinbase inputs have no prevout (and prevouts may be unpopulated).
+        if (!tx->is_coinbase())
+            for (const auto& in: *tx->inputs_ptr())
+                if (in->prevout && in->prevout->script().hash() == scripthash)
+                    out.emplace(in->point(), in->prevout->value());
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -84,6 +84,45 @@ code filter_points(points& out, const value_t& outpoints) NOEXCEPT
     return error::success;
 }
 
+// Each script is hashed once and each prevout probed once, so the cost is
+// linear in block size and independent of the number of watches.
+transaction_cptrs filter_block(const block& block, const scripthash_set& keys,
+    const point_set& points) NOEXCEPT
+{
+    transaction_cptrs out{};
+    if (keys.empty() && points.empty())
+        return out;
+
+    const auto matched = [&](const transaction& tx) NOEXCEPT
+    {
+        if (!keys.empty())
+            for (const auto& output: *tx.outputs_ptr())
+                if (keys.contains(output->script().hash()))
+                    return true;
+
+        if (tx.is_coinbase())
+            return false;
+
+        for (const auto& input: *tx.inputs_ptr())
+        {
+            if (!points.empty() && points.contains(input->point()))
+                return true;
+
+            if (!keys.empty() && input->prevout &&
+                keys.contains(input->prevout->script().hash()))
+                return true;
+        }
+
+        return false;
+    };
+
+    for (const auto& tx: *block.transactions_ptr())
+        if (matched(*tx))
+            out.push_back(tx);
+
+    return out;
+}
+
 BC_POP_WARNING()
 
 } // namespace btcd
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/byte_range.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto whitespace = " \t";
+constexpr std::string_view unit{ "bytes=" };
+
+static std::string_view trim(std::string_view value) NOEXCEPT
+{
+    const auto first = value.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+        return {};
+
+    const auto last = value.find_last_not_of(whitespace);
+    return value.substr(first, add1(last - first));
+}
+
+// The range unit is case-insensitive.
+static bool is_unit(std::string_view value) NOEXCEPT
+{
+    return std::ranges::equal(value, unit, [](char left, char right) NOEXCEPT
+    {
+        return (left >= 'A' && left <= 'Z' ?
+            static_cast<char>(left - 'A' + 'a') : left) == right;
+    });
+}
+
+// Decimal digits only, without overflow.
+static std::optional<size_t> to_position(std::string_view digits) NOEXCEPT
+{
+    if (digits.empty())
+        return {};
+
+    size_t out{};
+    for (const auto digit: digits)
+    {
+        if (digit < '0' || digit > '9')
+            return {};
+
+        const auto value = static_cast<size_t>(digit - '0');
+        if (out > (max_size_t - value) / 10u)
+            return {};
+
+        out = out * 10u + value;
+    }
+
+    return out;
+}
+
+size_t byte_range::length() const NOEXCEPT
+{
+    return add1(last - first);
+}
+
+range_request parse_range(byte_range& out, std::string_view range,
+    size_t size) NOEXCEPT
+{
+    range = trim(range);
+    if (range.size() <= unit.size() || !is_unit(range.substr(0, unit.size())))
+        return range_request::full;
+
+    range.remove_prefix(unit.size());
+    if (range.find(',') != std::string_view::npos)
+        return range_request::full;
+
+    const auto dash = range.find('-');
+    if (dash == std::string_view::npos)
+        return range_request::full;
+
+    const auto first = trim(range.substr(0, dash));
+    const auto last = trim(range.substr(add1(dash)));
+    out = { zero, zero, size };
+
+    // Suffix range, the final bytes (the whole representation if larger).
+    if (first.empty())
+    {
+        const auto suffix = to_position(last);
+        if (!suffix.has_value())
+            return range_request::full;
+
+        if (is_zero(suffix.value()) || is_zero(size))
+            return range_request::unsatisfiable;
+
+        out.first = size - std::min(suffix.value(), size);
+        out.last = sub1(size);
+        return range_request::partial;
+    }
+
+    const auto start = to_position(first);
+    const auto stop = last.empty() ? std::optional<size_t>{ max_size_t } :
+        to_position(last);
+
+    if (!start.has_value() || !stop.has_value() ||
+        stop.value() < start.value())
+        return range_request::full;
+
+    if (start.value() >= size)
+        return range_request::unsatisfiable;
+
+    out.first = start.value();
+    out.last = std::min(stop.value(), sub1(size));
+    return range_request::partial;
+}
+
+std::string to_content_range(const byte_range& range) NOEXCEPT
+{
+    return "bytes " + std::to_string(range.first) + "-" +
+        std::to_string(range.last) + "/" + std::to_string(range.size);
+}
+
+std::string to_content_range(size_t size) NOEXCEPT
+{
+    return "bytes */" + std::to_string(size);
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/content_coding.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <boost/beast/zlib.hpp>
+#include <boost/crc.hpp>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+namespace zlib = boost::beast::zlib;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto whitespace = " \t";
+constexpr size_t maximum_quality = 1000;
+constexpr auto compression_level = 6;
+constexpr auto window_bits = 15;
+constexpr auto memory_level = 8;
+
+// gzip member header (deflate, no flags, no mtime, unknown os).
+constexpr char gzip_header[]{ '\x1f', '\x8b', '\x08', '\x00', '\x00', '\x00',
+    '\x00', '\x00', '\x00', '\xff' };
+
+// zlib stream header (deflate, 32k window, default level, check bits).
+constexpr char zlib_header[]{ '\x78', '\x9c' };
+
+static std::string_view trim(std::string_view value) NOEXCEPT
+{
+    const auto first = value.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+        return {};
+
+    const auto last = value.find_last_not_of(whitespace);
+    return value.substr(first, add1(last - first));
+}
+
+static char to_lower(char character) NOEXCEPT
+{
+    return character >= 'A' && character <= 'Z' ?
+        static_cast<char>(character - 'A' + 'a') : character;
+}
+
+static bool is_coding(std::string_view value, std::string_view name) NOEXCEPT
+{
+    return std::ranges::equal(value, name, [](char left, char right) NOEXCEPT
+    {
+        return to_lower(left) == right;
+    });
+}
+
+// Quality value (RFC 9110 section 12.4.2) in thousandths, maximum if absent.
+static size_t to_quality(std::string_view params) NOEXCEPT
+{
+    while (!params.empty())
+    {
+        const auto semicolon = params.find(';');
+        const auto param = trim(params.substr(0, semicolon));
+        if (param.size() > 2u && to_lower(param.front()) == 'q' &&
+            param.at(1) == '=')
+        {
+            const auto value = param.substr(2);
+            if (value.front() == '1')
+                return maximum_quality;
+
+            // Otherwise "0" or "0." and digits (invalid is unacceptable).
+            if (value.size() <= 2u || value.front() != '0' ||
+                value.at(1) != '.')
+                return zero;
+
+            size_t quality{};
+            size_t scale{ 100 };
+            for (const auto digit: value.substr(2, 3))
+            {
+                if (digit < '0' || digit > '9')
+                    return zero;
+
+                quality += scale * static_cast<size_t>(digit - '0');
+                scale /= 10u;
+            }
+
+            return quality;
+        }
+
+        if (semicolon == std::string_view::npos)
+            break;
+
+        params.remove_prefix(add1(semicolon));
+    }
+
+    return maximum_quality;
+}
+
+content_coding negotiate_coding(std::string_view accept_encoding) NOEXCEPT
+{
+    // Unlisted codings take the wildcard quality, or are unacceptable.
+    std::optional<size_t> gzip{}, deflate{}, wildcard{};
+    while (!accept_encoding.empty())
+    {
+        const auto comma = accept_encoding.find(',');
+        const auto element = accept_encoding.substr(0, comma);
+        const auto semicolon = element.find(';');
+        const auto name = trim(element.substr(0, semicolon));
+        const auto quality = semicolon == std::string_view::npos ?
+            maximum_quality : to_quality(element.substr(add1(semicolon)));
+
+        if (is_coding(name, "gzip") || is_coding(name, "x-gzip"))
+            gzip = quality;
+        else if (is_coding(name, "deflate"))
+            deflate = quality;
+        else if (name == "*")
+            wildcard = quality;
+
+        if (comma == std::string_view::npos)
+            break;
+
+        accept_encoding.remove_prefix(add1(comma));
+    }
+
+    const auto gzip_quality = gzip.value_or(wildcard.value_or(zero));
+    const auto deflate_quality = deflate.value_or(wildcard.value_or(zero));
+
+    if (!is_zero(gzip_quality) && gzip_quality >= deflate_quality)
+        return content_coding::gzip;
+
+    if (!is_zero(deflate_quality))
+        return content_coding::deflate;
+
+    return content_coding::identity;
+}
+
+std::string_view from_content_coding(content_coding coding) NOEXCEPT
+{
+    switch (coding)
+    {
+        case content_coding::gzip:
+            return "gzip";
+        case content_coding::deflate:
+            return "deflate";
+        default:
+            return "identity";
+    }
+}
+
+// Adler-32 (RFC 1950 section 8).
+static uint32_t adler32(std::string_view body) NOEXCEPT
+{
+    constexpr uint32_t modulus = 65521;
+
+    // Largest count for which the sums cannot overflow 32 bits.
+    constexpr size_t block = 5552;
+
+    uint32_t low{ 1 }, high{};
+    while (!body.empty())
+    {
+        const auto count = std::min(block, body.size());
+        for (const auto byte: body.substr(0, count))
+        {
+            low += static_cast<uint8_t>(byte);
+            high += low;
+        }
+
+        low %= modulus;
+        high %= modulus;
+        body.remove_prefix(count);
+    }
+
+    return (high << 16) | low;
+}
+
+static void append_little(std::string& out, uint32_t value) NOEXCEPT
+{
+    for (auto byte = 0u; byte < sizeof(uint32_t); ++byte)
+        out.push_back(static_cast<char>(value >> (byte * 8u)));
+}
+
+static void append_big(std::string& out, uint32_t value) NOEXCEPT
+{
+    for (auto byte = sizeof(uint32_t); !is_zero(byte); --byte)
+        out.push_back(static_cast<char>(value >> (sub1(byte) * 8u)));
+}
+
+// The beast deflate stream is raw (RFC 1951), so the coding wrappers (header
+// and integrity trailer) are applied here.
+std::string compress(std::string_view body, content_coding coding) NOEXCEPT
+{
+    if (coding == content_coding::identity)
+        return {};
+
+    const auto gzip = coding == content_coding::gzip;
+    const std::string_view header = gzip ?
+        std::string_view{ gzip_header, sizeof(gzip_header) } :
+        std::string_view{ zlib_header, sizeof(zlib_header) };
+
+    zlib::deflate_stream stream{};
+    stream.reset(compression_level, window_bits, memory_level,
+        zlib::Strategy::normal);
+
+    // Sized for single step completion (header, body and trailer).
+    const auto bound = stream.upper_bound(body.size());
+    std::string out(header.size() + bound + 2u * sizeof(uint32_t), '\0');
+    std::ranges::copy(header, out.begin());
+
+    zlib::z_params params{};
+    params.next_in = body.data();
+    params.avail_in = body.size();
+    params.next_out = std::next(out.data(), header.size());
+    params.avail_out = bound;
+
+    boost::beast::error_code ec{};
+    stream.write(params, zlib::Flush::finish, ec);
+    if (ec != zlib::error::end_of_stream)
+        return {};
+
+    out.resize(header.size() + params.total_out);
+    if (gzip)
+    {
+        boost::crc_32_type crc{};
+        crc.process_bytes(body.data(), body.size());
+        append_little(out, crc.checksum());
+        append_little(out, static_cast<uint32_t>(body.size()));
+    }
+    else
+    {
+        append_big(out, adler32(body));
+    }
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/entity_tag.hpp>
+
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace network::http;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto separator = '/';
+constexpr auto weak_prefix = "W/";
+constexpr auto whitespace = " \t";
+
+static std::string_view trim(std::string_view value) NOEXCEPT
+{
+    const auto first = value.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+        return {};
+
+    const auto last = value.find_last_not_of(whitespace);
+    return value.substr(first, add1(last - first));
+}
+
+std::string entity_tag(std::string_view interface, std::string_view method,
+    const hash_digest& hash, std::string_view params,
+    media_type media) NOEXCEPT
+{
+    std::string key{ interface };
+    key.push_back(separator);
+    key.append(method);
+    key.push_back(separator);
+    key.append(encode_hash(hash));
+    key.push_back(separator);
+    key.append(params);
+    key.push_back(separator);
+    key.append(from_media_type(media));
+    return "\"" + encode_base16(sha256_hash(key)) + "\"";
+}
+
+bool entity_wildcard(std::string_view if_none_match) NOEXCEPT
+{
+    return trim(if_none_match) == "*";
+}
+
+bool entity_match(std::string_view if_none_match,
+    std::string_view tag) NOEXCEPT
+{
+    while (!if_none_match.empty())
+    {
+        const auto comma = if_none_match.find(',');
+        auto element = trim(if_none_match.substr(0, comma));
+        if (element.starts_with(weak_prefix))
+            element.remove_prefix(std::string_view{ weak_prefix }.size());
+
+        if (element == tag)
+            return true;
+
+        if (comma == std::string_view::npos)
+            break;
+
+        if_none_match.remove_prefix(add1(comma));
+    }
+
+    return false;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/fee_histogram.hpp>
+
+#include <optional>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// A big lump of vsize at one rate closes the prior (partial) bin, so that the
+// lump is not attributed to the higher rate.
+fee_bins compact_fee_rates(const fee_rates& rates,
+    uint64_t bin_size) NOEXCEPT
+{
+    fee_bins out{};
+    if (is_zero(bin_size))
+        return out;
+
+    auto limit = to_floating(bin_size);
+    uint64_t cumulative{};
+    std::optional<uint64_t> prior{};
+    for (const auto& [rate, size]: rates)
+    {
+        if (to_floating(size) > two * limit && prior.has_value() &&
+            is_nonzero(cumulative))
+        {
+            out.emplace_back(prior.value(), cumulative);
+            cumulative = zero;
+            limit *= 1.1;
+        }
+
+        cumulative += size;
+        if (to_floating(cumulative) > limit)
+        {
+            out.emplace_back(rate, cumulative);
+            cumulative = zero;
+            limit *= 1.1;
+        }
+
+        prior = rate;
+    }
+
+    return out;
+}
+
+fee_bins fee_histogram(const chain::block& block) NOEXCEPT
+{
+    fee_rates rates{};
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        if (tx->is_coinbase())
+            continue;
+
+        // The fee is unknown if any prevout is unpopulated, so the tx is skipped.
+        uint64_t input{};
+        auto populated = true;
+        for (const auto& in: *tx->inputs_ptr())
+        {
+            if (!in->prevout)
+            {
+                populated = false;
+                break;
+            }
+
+            input += in->prevout->value();
+        }
+
+        if (!populated)
+            continue;
+
+        uint64_t output{};
+        for (const auto& out: *tx->outputs_ptr())
+            output += out->value();
+
+        // The fee rate is satoshis per virtual byte (weight rounded up).
+        const auto weight = tx->weight();
+        const auto vsize = ceilinged_divide(weight,
+            chain::light_weight_factor);
+        if (is_zero(vsize))
+            continue;
+
+        const auto fee = floored_subtract(input, output);
+        rates[fee / vsize] += vsize;
+    }
+
+    return compact_fee_rates(rates);
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
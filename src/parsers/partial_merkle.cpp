@@ -39,26 +39,13 @@ static hash_digest node_hash(const hash_digest& left,
     return sha256::merkle_root(hashes{ left, right });
 }
 
-// The hash of the subtree rooted at (height, pos) over the block's txids.
-static hash_digest calc_hash(size_t height, size_t pos,
-    const hashes& txids) NOEXCEPT
-{
-    if (is_zero(height))
-        return txids.at(pos);
-
-    const auto left = calc_hash(sub1(height), pos * two, txids);
-    const auto right =
-        (pos * two + one) < tree_width(txids.size(), sub1(height)) ?
-            calc_hash(sub1(height), pos * two + one, txids) : left;
-
-    return node_hash(left, right);
-}
-
 // Depth-first build of the flag bits and branch hashes (bip37).
-static void traverse_build(size_t height, size_t pos, const hashes& txids,
-    const std::vector<bool>& match, std::vector<bool>& bits,
-    hashes& branch) NOEXCEPT
+static void traverse_build(size_t height, size_t pos,
+    const merkle_levels& levels, const std::vector<bool>& match,
+    std::vector<bool>& bits, hashes& branch) NOEXCEPT
 {
+    const auto& txids = levels.front();
+
     // This node is a parent of a match if any covered leaf is matched.
     auto parent_of_match = false;
     const auto width = power2(height);
@@ -71,14 +58,14 @@ static void traverse_build(size_t height, size_t pos, const hashes& txids,
     if (is_zero(height) || !parent_of_match)
     {
         // Leaf, or a subtree with no match: store its hash and stop.
-        branch.push_back(calc_hash(height, pos, txids));
+        branch.push_back(levels.at(height).at(pos));
         return;
     }
 
     // Descend into both subtrees (the right may be a duplicate of the left).
-    traverse_build(sub1(height), pos * two, txids, match, bits, branch);
+    traverse_build(sub1(height), pos * two, levels, match, bits, branch);
     if (pos * two + one < tree_width(txids.size(), sub1(height)))
-        traverse_build(sub1(height), pos * two + one, txids, match, bits,
+        traverse_build(sub1(height), pos * two + one, levels, match, bits,
             branch);
 }
 
@@ -166,12 +153,65 @@ static size_t tree_height(size_t txs) NOEXCEPT
     return height;
 }
 
+merkle_levels to_merkle_levels(hashes&& txids) NOEXCEPT
+{
+    merkle_levels levels{};
+    if (txids.empty())
+        return levels;
+
+    levels.reserve(add1(tree_height(txids.size())));
+    levels.push_back(std::move(txids));
+    while (levels.back().size() > one)
+    {
+        const auto& below = levels.back();
+        hashes level(ceilinged_divide(below.size(), two));
+        for (size_t pos{}; pos < level.size(); ++pos)
+        {
+            const auto& left = below.at(pos * two);
+            const auto right = pos * two + one;
+            level.at(pos) = node_hash(left,
+                right < below.size() ? below.at(right) : left);
+        }
+
+        levels.push_back(std::move(level));
+    }
+
+    return levels;
+}
+
+hashes merkle_branch(const merkle_levels& levels, size_t position) NOEXCEPT
+{
+    hashes branch{};
+    if (levels.empty())
+        return branch;
+
+    branch.reserve(sub1(levels.size()));
+    for (size_t height{}; height < sub1(levels.size()); ++height)
+    {
+        // The last node of an odd level is paired with itself.
+        const auto& level = levels.at(height);
+        const auto sibling = is_even(position) ? add1(position) :
+            sub1(position);
+        branch.push_back(level.at(sibling < level.size() ? sibling : position));
+        position = to_half(position);
+    }
+
+    return branch;
+}
+
 void build_partial_merkle(data_chunk& flags, hashes& branch,
     const hashes& txids, const std::vector<bool>& match) NOEXCEPT
+{
+    build_partial_merkle(flags, branch, to_merkle_levels(hashes{ txids }),
+        match);
+}
+
+void build_partial_merkle(data_chunk& flags, hashes& branch,
+    const merkle_levels& levels, const std::vector<bool>& match) NOEXCEPT
 {
     branch.clear();
     std::vector<bool> bits{};
-    traverse_build(tree_height(txids.size()), zero, txids, match, bits, branch);
+    traverse_build(sub1(levels.size()), zero, levels, match, bits, branch);
     flags = bits_to_bytes(bits);
 }
 
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/parsers/tx_package.hpp>
+
+#include <set>
+#include <unordered_map>
+#include <variant>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace system::chain;
+using namespace network::rpc;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+code parse_package(transaction_cptrs& out, const array_t& raw_txs) NOEXCEPT
+{
+    if (raw_txs.empty() || raw_txs.size() > maximum_package_count)
+        return error::invalid_argument;
+
+    out.clear();
+    out.reserve(raw_txs.size());
+    for (const auto& raw_tx: raw_txs)
+    {
+        if (!std::holds_alternative<string_t>(raw_tx.value()))
+            return error::invalid_argument;
+
+        read::base16::copy hexer{ std::get<string_t>(raw_tx.value()) };
+        const auto tx = to_shared<transaction>(hexer, true);
+        if (!tx->is_valid() || !hexer.is_exhausted())
+            return error::invalid_argument;
+
+        out.push_back(tx);
+    }
+
+    return order_package(out);
+}
+
+code order_package(transaction_cptrs& txs) NOEXCEPT
+{
+    const auto count = txs.size();
+    if (is_zero(count) || count > maximum_package_count)
+        return error::invalid_argument;
+
+    std::unordered_map<hash_digest, size_t> positions{};
+    for (size_t position{}; position < count; ++position)
+        if (!positions.emplace(txs.at(position)->hash(false), position).second)
+            return error::invalid_argument;
+
+    // Edges from each in-package parent to its children, counted per spend.
+    std::set<point> spent{};
+    std::vector<size_t> parents(count);
+    std::vector<std::vector<size_t>> children(count);
+    for (size_t child{}; child < count; ++child)
+    {
+        for (const auto& input: *txs.at(child)->inputs_ptr())
+        {
+            // Null points (coinbase) are left to validation.
+            const auto& point = input->point();
+            if (!point.is_null() && !spent.insert(point).second)
+                return error::invalid_argument;
+
+            const auto parent = positions.find(point.hash());
+            if (parent == positions.end())
+                continue;
+
+            if (parent->second == child)
+                return error::invalid_argument;
+
+            children.at(parent->second).push_back(child);
+            ++parents.at(child);
+        }
+    }
+
+    // Packages are small, so the earliest ready transaction is simply found
+    // by scan, which preserves the given order among independent transactions.
+    transaction_cptrs out{};
+    out.reserve(count);
+    std::vector<bool> ordered(count);
+    while (out.size() < count)
+    {
+        size_t next{};
+        while (next < count && (ordered.at(next) || !is_zero(parents.at(next))))
+            ++next;
+
+        // Cyclic dependency.
+        if (next == count)
+            return error::invalid_argument;
+
+        ordered.at(next) = true;
+        out.push_back(txs.at(next));
+        for (const auto child: children.at(next))
+            --parents.at(child);
+    }
+
+    txs = std::move(out);
+    return error::success;
+}
+
+void populate_package(const transaction_cptrs& txs) NOEXCEPT
+{
+    std::unordered_map<hash_digest, transaction::cptr> parents{};
+    for (const auto& tx: txs)
+        parents.emplace(tx->hash(false), tx);
+
+    for (const auto& tx: txs)
+    {
+        for (const auto& input: *tx->inputs_ptr())
+        {
+            const auto& point = input->point();
+            const auto parent = parents.find(point.hash());
+            if (parent == parents.end())
+                continue;
+
+            // An invalid index is left unpopulated, to fail validation.
+            const auto& outputs = *parent->second->outputs_ptr();
+            if (point.index() < outputs.size())
+                input->prevout = outputs.at(point.index());
+        }
+    }
+}
+
+void reject_orphans(tx_package& package) NOEXCEPT
+{
+    const auto count = package.txs.size();
+    if (package.faults.size() != count)
+        return;
+
+    std::unordered_map<hash_digest, size_t> positions{};
+    for (size_t position{}; position < count; ++position)
+        positions.emplace(package.txs.at(position)->hash(false), position);
+
+    for (size_t child{}; child < count; ++child)
+    {
+        auto& fault = package.faults.at(child);
+        if (fault)
+            continue;
+
+        for (const auto& input: *package.txs.at(child)->inputs_ptr())
+        {
+            const auto parent = positions.find(input->point().hash());
+            if (parent != positions.end() && package.faults.at(parent->second))
+            {
+                fault = system::error::missing_previous_output;
+                break;
+            }
+        }
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -23,6 +23,7 @@
 #include <utility>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -54,6 +55,9 @@ void protocol_admin::start() NOEXCEPT
     // Subscription methods.
     SUBSCRIBE_ADMIN(handle_get_log_subscribe, _1, _2, _3, _4);
     SUBSCRIBE_ADMIN(handle_get_event_subscribe, _1, _2, _3, _4);
+
+    // Diagnostic methods.
+    SUBSCRIBE_ADMIN(handle_get_subscriptions, _1, _2, _3);
     protocol_html::start();
 }
 
@@ -189,6 +193,29 @@ bool protocol_admin::handle_get_event_subscribe(const code& ec,
     return true;
 }
 
+bool protocol_admin::handle_get_subscriptions(const code& ec,
+    interface::subscriptions, uint8_t /*version*/) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped(ec))
+        return false;
+
+    // Address status (with checkpoints) is shared by all channels.
+    const auto totals = server().usage().get();
+    const auto bytes = totals.bytes + server().statuses().memory();
+    const auto average = is_zero(totals.subscriptions) ? zero :
+        bytes / totals.subscriptions;
+
+    send_json(
+    {
+        { "subscriptions", totals.subscriptions },
+        { "bytes", bytes },
+        { "bytes_per_subscription", average }
+    }, 96);
+    return true;
+}
+
 // Event handlers.
 // ----------------------------------------------------------------------------
 
@@ -23,6 +23,7 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -40,11 +41,20 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 BC_PUSH_WARNING(SMART_PTR_NOT_NEEDED)
 BC_PUSH_WARNING(NO_VALUE_OR_CONST_REF_SHARED_PTR)
 
-// Terminal dispatch.
+// Terminal routing.
 // ----------------------------------------------------------------------------
 // This class is attached to the channel after the subgroup protocols, which
-// claim requests defined by their interfaces. Defaults are sent here exactly
-// once and only when no subgroup has claimed the request.
+// set their routes upon start. Requests are validated here once and routed to
+// the owning subgroup. Defaults are sent here only when no subgroup owns the
+// method, and no protocol attached earlier has claimed the request.
+
+// Routes retain their subgroup protocols, so are released upon stop.
+void protocol_bitcoind::stopping(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    router_.clear();
+    network::protocol_http::stopping(ec);
+}
 
 // Claimed by rest (when attached), otherwise disallowed.
 void protocol_bitcoind::handle_receive_get(const code& ec,
@@ -87,7 +97,7 @@ void protocol_bitcoind::handle_receive_options(const code& ec,
     send_ok(*options);
 }
 
-// The subgroup protocols handle claimed posts.
+// Posts are routed to the subgroup protocols (which respond).
 void protocol_bitcoind::handle_receive_post(const code& ec,
     const post::cptr& post) NOEXCEPT
 {
@@ -96,7 +106,7 @@ void protocol_bitcoind::handle_receive_post(const code& ec,
     if (stopped(ec))
         return;
 
-    // A subgroup protocol has claimed (and responds to) the request.
+    // A protocol attached earlier has claimed (and responds to) the request.
     if (claimed())
         return;
 
@@ -122,7 +132,8 @@ void protocol_bitcoind::handle_receive_post(const code& ec,
     }
 
     // Get the parsed json-rpc request object.
-    // v1 or v2 both supported, batch not yet supported.
+    // v1 or v2 both supported, v2 batch elements are delivered individually
+    // by the channel, which aggregates their responses (in request order).
     // v1 null id and v2 missing id implies notification and no response.
     const auto& message = post->body().get<request>().message;
 
@@ -136,18 +147,25 @@ void protocol_bitcoind::handle_receive_post(const code& ec,
         return;
     }
 
+    // Route the request to the owning subgroup (which responds).
+    if (router_.route(subgroup_methods(), message, post))
+    {
+        reset_rpc_request();
+        return;
+    }
+
     // No subgroup interface defines the method.
     send_error(network::error::unexpected_method);
 }
 
-// The websocket transport of the interface: subgroup protocols handle claimed
-// frames, invalid frames stop the channel here.
+// The websocket transport of the interface: frames are routed to subgroup
+// protocols, invalid frames stop the channel here.
 void protocol_bitcoind::dispatch_websocket(
     const network::http::request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    // A subgroup protocol has claimed (and responds to) the request.
+    // A protocol attached earlier has claimed (and responds to) the request.
     if (claimed())
         return;
 
@@ -178,6 +196,14 @@ void protocol_bitcoind::dispatch_websocket(
         return;
     }
 
+    // Route the frame to the owning subgroup (which responds).
+    if (router_.route(subgroup_methods(), message, {}))
+    {
+        id_.reset();
+        version_ = version::undefined;
+        return;
+    }
+
     // No subgroup interface defines the method.
     send_error(network::error::unexpected_method);
 }
@@ -285,6 +311,8 @@ void protocol_bitcoind::send_rpc(response_t&& model, size_t size_hint,
         return;
     }
 
+    // Not compressed, as v2 batch responses are aggregated by the channel at
+    // its final write, which requires the model body (not encoded bytes).
     const auto request = reset_rpc_request();
     http::response message{ status::ok, request->version() };
     add_common_headers(message, *request);
@@ -325,25 +353,77 @@ http::request_cptr protocol_bitcoind::reset_rpc_request() NOEXCEPT
     return reset_request();
 }
 
+// Deferral.
+// ----------------------------------------------------------------------------
+// Expensive handlers execute their queries on the parallel pool, so as not to
+// hold the channel strand. The number of these calls is bounded server-wide.
+
+// protected
+protocol_bitcoind::deferred_ptr protocol_bitcoind::defer(
+    const std::string& method) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto call = server().calls().begin(method);
+    if (is_zero(call))
+        return {};
+
+    const auto deferred = std::make_shared<deferred_t>();
+    deferred->call = call;
+    deferred->version = version_;
+    deferred->id = id_;
+
+    // The websocket transport has no http request to capture.
+    if (websocket())
+    {
+        id_.reset();
+        version_ = version::undefined;
+    }
+    else
+    {
+        deferred->request = reset_rpc_request();
+    }
+
+    return deferred;
+}
+
+// protected
+void protocol_bitcoind::complete_deferred(const code& ec,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    server().calls().end(deferred->call);
+    monitor(false);
+    if (stopped())
+        return;
+
+    // The websocket transport has no http request to restore (see defer).
+    id_ = deferred->id;
+    version_ = deferred->version;
+    if (deferred->request)
+        set_request(deferred->request);
+
+    if (ec)
+    {
+        send_error(ec, std::move(deferred->result), deferred->size_hint);
+        return;
+    }
+
+    send_result(std::move(deferred->result), deferred->size_hint);
+}
+
 // utility (redundant with protocol_electrum)
 // ----------------------------------------------------------------------------
 
 code protocol_bitcoind::validate_tx(
     const chain::transaction& tx) const NOEXCEPT
 {
+    // The context of the next block, in which a pool tx would confirm.
     const auto& query = archive();
-    const auto& settings = system_settings();
-    const auto link = query.to_confirmed(query.get_top_confirmed());
-    const auto key = query.get_header_key(link);
-    const auto state = query.get_chain_state(settings, key);
-
-    // The store always has chain state for the confirmed top.
-    if (!state)
+    const auto next = server().states().get(query, system_settings());
+    if (!next)
         return database::error::integrity;
 
-    // The context of the next block, in which a pool tx would confirm.
-    const auto pool = chain::chain_state{ *state, settings }.context();
-    return node::validate_transaction(tx, query, pool);
+    return node::validate_transaction(tx, query, next->state->context());
 }
 
 code protocol_bitcoind::broadcast_tx(
@@ -352,10 +432,16 @@ code protocol_bitcoind::broadcast_tx(
     if (const auto ec = validate_tx(*tx))
         return ec;
 
-    BROADCAST(peer::transaction, to_shared<peer::transaction>(tx));
+    relay_tx(tx);
     return error::success;
 }
 
+void protocol_bitcoind::relay_tx(
+    const chain::transaction::cptr& tx) NOEXCEPT
+{
+    BROADCAST(peer::transaction, to_shared<peer::transaction>(tx));
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -25,6 +25,7 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 
@@ -148,20 +149,48 @@ bool protocol_bitcoind_blockchain::handle_get_block(const code& ec,
         return true;
     }
 
+    const auto deferred = defer("getblock");
+    if (!deferred)
+    {
+        send_error(error::server_busy);
+        return true;
+    }
+
+    monitor(true);
+    PARALLEL(do_get_block, hash, blockhash, level, deferred);
+    return true;
+}
+
+void protocol_bitcoind_blockchain::do_get_block(const hash_digest& hash,
+    const std::string& blockhash, size_t level,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+    if (stopping_)
+    {
+        POST(complete_deferred, network::error::channel_stopped, deferred);
+        return;
+    }
+
     constexpr auto witness = true;
     const auto& query = archive();
     const auto link = query.to_header(hash);
     const auto block = query.get_block(link, witness);
     if (!block)
     {
-        send_error(error::not_found, blockhash, blockhash.size());
-        return true;
+        deferred->result = blockhash;
+        deferred->size_hint = blockhash.size();
+        POST(complete_deferred, error::not_found, deferred);
+        return;
     }
 
     if (level == block_verbosity::hex)
     {
-        send_text(to_text(*block, block->serialized_size(witness), witness));
-        return true;
+        auto text = to_text(*block, block->serialized_size(witness), witness);
+        deferred->size_hint = text.size();
+        deferred->result = std::move(text);
+        POST(complete_deferred, error::success, deferred);
+        return;
     }
 
     auto model = level == block_verbosity::hashed ?
@@ -169,8 +198,9 @@ bool protocol_bitcoind_blockchain::handle_get_block(const code& ec,
         value_from(bitcoind_verbose(*block));
 
     inject_block_context(model.as_object(), query, link, block->header());
-    send_result(std::move(model), two * block->serialized_size(witness));
-    return true;
+    deferred->result = std::move(model);
+    deferred->size_hint = two * block->serialized_size(witness);
+    POST(complete_deferred, error::success, deferred);
 }
 
 bool protocol_bitcoind_blockchain::handle_get_block_chain_info(const code& ec,
@@ -352,12 +382,36 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
         return true;
     }
 
+    const auto deferred = defer("getblockstats");
+    if (!deferred)
+    {
+        send_error(error::server_busy);
+        return true;
+    }
+
+    monitor(true);
+    PARALLEL(do_get_block_stats, link, height, stats, deferred);
+    return true;
+}
+
+void protocol_bitcoind_blockchain::do_get_block_stats(
+    const database::header_link& link, size_t height, const array_t& stats,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+    if (stopping_)
+    {
+        POST(complete_deferred, network::error::channel_stopped, deferred);
+        return;
+    }
+
     // Fees require prevout values, populated from the store.
+    const auto& query = archive();
     const auto block = query.get_block(link, true);
     if (!block || !query.populate_without_metadata(*block))
     {
-        send_error(database::error::integrity);
-        return true;
+        POST(complete_deferred, database::error::integrity, deferred);
+        return;
     }
 
     const auto& settings = system_settings();
@@ -374,10 +428,12 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
         subsidy, repeat);
 
     // An empty selection returns all statistics, otherwise the named subset.
+    deferred->size_hint = 1024;
     if (stats.empty())
     {
-        send_result(std::move(result), 1024);
-        return true;
+        deferred->result = std::move(result);
+        POST(complete_deferred, error::success, deferred);
+        return;
     }
 
     object_t selected{};
@@ -385,23 +441,23 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
     {
         if (!std::holds_alternative<string_t>(stat.value()))
         {
-            send_error(error::invalid_argument);
-            return true;
+            POST(complete_deferred, error::invalid_argument, deferred);
+            return;
         }
 
         const auto& name = std::get<string_t>(stat.value());
         const auto it = result.find(name);
         if (it == result.end())
         {
-            send_error(error::invalid_argument);
-            return true;
+            POST(complete_deferred, error::invalid_argument, deferred);
+            return;
         }
 
         selected.emplace(name, it->second);
     }
 
-    send_result(std::move(selected), 1024);
-    return true;
+    deferred->result = std::move(selected);
+    POST(complete_deferred, error::success, deferred);
 }
 
 // The window tx count is summed over the window (cost is linear in the window
@@ -454,11 +510,35 @@ bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
         }
     }
 
+    const auto deferred = defer("getchaintxstats");
+    if (!deferred)
+    {
+        send_error(error::server_busy);
+        return true;
+    }
+
+    monitor(true);
+    PARALLEL(do_get_chain_tx_stats, link, height, window, deferred);
+    return true;
+}
+
+void protocol_bitcoind_blockchain::do_get_chain_tx_stats(
+    const database::header_link& link, size_t height, size_t window,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+    if (stopping_)
+    {
+        POST(complete_deferred, network::error::channel_stopped, deferred);
+        return;
+    }
+
+    const auto& query = archive();
     const auto header = query.get_header(link);
     if (!header)
     {
-        send_error(database::error::integrity);
-        return true;
+        POST(complete_deferred, database::error::integrity, deferred);
+        return;
     }
 
     object_t result
@@ -477,9 +557,19 @@ bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
         const auto interval = floored_subtract(median_time_past(query, link),
             median_time_past(query, past));
 
+        // The window is caller-sized, so the summation is cancelable.
         size_t txs{};
         for (auto index = add1(first); index <= height; ++index)
+        {
+            if (stopping_)
+            {
+                POST(complete_deferred, network::error::channel_stopped,
+                    deferred);
+                return;
+            }
+
             txs += query.get_tx_count(query.to_confirmed(index));
+        }
 
         result.emplace("window_interval", interval);
         result.emplace("window_tx_count", txs);
@@ -488,8 +578,9 @@ bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
             result.emplace("txrate", to_floating(txs) / interval);
     }
 
-    send_result(std::move(result), 256);
-    return true;
+    deferred->result = std::move(result);
+    deferred->size_hint = 256;
+    POST(complete_deferred, error::success, deferred);
 }
 
 bool protocol_bitcoind_blockchain::handle_get_tx_out(const code& ec,
@@ -622,8 +713,6 @@ bool protocol_bitcoind_blockchain::handle_get_tx_out_proof(const code& ec,
     rpc_interface::get_tx_out_proof, const array_t& txids,
     const std::string& blockhash) NOEXCEPT
 {
-    using namespace messages::peer;
-
     if (stopped(ec))
         return false;
 
@@ -646,36 +735,59 @@ bool protocol_bitcoind_blockchain::handle_get_tx_out_proof(const code& ec,
         }
     }
 
-    const auto& query = archive();
-    auto link = query.find_confirmed_block(*targets.begin());
-
     // The block may be specified, otherwise the first txid determines it.
-    if (!blockhash.empty())
+    hash_digest block{ null_hash };
+    if (!blockhash.empty() && !decode_hash(block, blockhash))
     {
-        hash_digest hash{};
-        if (!decode_hash(hash, blockhash))
-        {
-            send_error(error::invalid_argument);
-            return true;
-        }
+        send_error(error::invalid_argument);
+        return true;
+    }
 
-        link = query.to_header(hash);
+    const auto deferred = defer("gettxoutproof");
+    if (!deferred)
+    {
+        send_error(error::server_busy);
+        return true;
     }
 
+    monitor(true);
+    PARALLEL(do_get_tx_out_proof, std::move(targets), block, deferred);
+    return true;
+}
+
+// The block hash is null if not specified (null is not a valid block hash).
+void protocol_bitcoind_blockchain::do_get_tx_out_proof(
+    const std::unordered_set<hash_digest>& targets, const hash_digest& block,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    using namespace messages::peer;
+    BC_ASSERT(!stranded());
+    if (stopping_)
+    {
+        POST(complete_deferred, network::error::channel_stopped, deferred);
+        return;
+    }
+
+    const auto& query = archive();
+    const auto link = block == null_hash ?
+        query.find_confirmed_block(*targets.begin()) : query.to_header(block);
+
     if (!query.is_associated(link))
     {
-        send_error(error::not_found);
-        return true;
+        POST(complete_deferred, error::not_found, deferred);
+        return;
     }
 
-    // Empty implies fault (the link resolves to an associated block).
-    const auto keys = query.get_tx_keys(link);
-    if (keys.empty())
+    // Null implies fault (the link resolves to an associated block).
+    const auto levels = server().merkles().get(query, link);
+    if (!levels)
     {
-        send_error(database::error::integrity);
-        return true;
+        POST(complete_deferred, database::error::integrity, deferred);
+        return;
     }
 
+    const auto& keys = levels->front();
+
     // All targets must be in the block (matched in block order).
     // Not ranges algorithms, as the vector<bool> proxy iterator does not
     // satisfy indirectly_writable under libc++.
@@ -689,26 +801,29 @@ bool protocol_bitcoind_blockchain::handle_get_tx_out_proof(const code& ec,
     if (to_unsigned(std::count(match.begin(), match.end(), true)) !=
         targets.size())
     {
-        send_error(error::not_found);
-        return true;
+        POST(complete_deferred, error::not_found, deferred);
+        return;
     }
 
     const auto header = query.get_header(link);
     if (!header)
     {
-        send_error(database::error::integrity);
-        return true;
+        POST(complete_deferred, database::error::integrity, deferred);
+        return;
     }
 
     const auto size = possible_narrow_cast<uint32_t>(keys.size());
     merkle_block merkle{ header, size, {}, {} };
-    build_partial_merkle(merkle.flags, merkle.hashes, keys, match);
+    build_partial_merkle(merkle.flags, merkle.hashes, *levels, match);
 
     const auto version = merkle_block::version_maximum;
     data_chunk out(merkle.size(version));
     merkle.serialize(version, out);
-    send_text(encode_base16(out));
-    return true;
+
+    auto text = encode_base16(out);
+    deferred->size_hint = text.size();
+    deferred->result = std::move(text);
+    POST(complete_deferred, error::success, deferred);
 }
 
 // Verifies a serialized merkle block, returning the array of proven txids, or
@@ -19,10 +19,12 @@
 #include <bitcoin/server/protocols/protocol_bitcoind_control.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <utility>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 
@@ -126,19 +128,36 @@ bool protocol_bitcoind_control::handle_get_openrpc_info(const code& ec,
     return true;
 }
 
-// Dispatch is synchronous on the channel strand, so there is no set of
-// in-flight commands to report (bitcoind lists its own call here).
+// Reports the calls in flight on the parallel pool (server-wide), with their
+// durations in microseconds. Other calls complete synchronously on the channel
+// strand, so this call is not listed (bitcoind lists its own call here).
 bool protocol_bitcoind_control::handle_get_rpc_info(const code& ec,
     rpc_interface::get_rpc_info) NOEXCEPT
 {
     if (stopped(ec))
         return false;
 
+    using namespace std::chrono;
+    const auto calls = server().calls().active();
+    const auto now = rpc_calls::clock::now();
+
+    array_t active{};
+    active.reserve(calls.size());
+    for (const auto& call: calls)
+    {
+        const auto duration = duration_cast<microseconds>(now - call.start);
+        active.push_back(object_t
+        {
+            { "method", call.method },
+            { "duration", to_unsigned(duration.count()) }
+        });
+    }
+
     send_result(object_t
     {
-        { "active_commands", array_t{} },
+        { "active_commands", std::move(active) },
         { "logpath", server_config().log.log_file1().string() }
-    }, 128);
+    }, 128 + 64 * calls.size());
     return true;
 }
 
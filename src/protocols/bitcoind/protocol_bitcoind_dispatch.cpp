@@ -19,18 +19,68 @@
 #include <bitcoin/server/protocols/protocol_bitcoind_dispatch.hpp>
 
 #include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 
 namespace libbitcoin {
 namespace server {
 
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// The subgroup interfaces, by ordinal (route index).
+using subgroups = std::tuple<
+    interface::bitcoind_blockchain,
+    interface::bitcoind_control,
+    interface::bitcoind_mining,
+    interface::bitcoind_network,
+    interface::bitcoind_notifications,
+    interface::bitcoind_test,
+    interface::bitcoind_transaction,
+    interface::bitcoind_utility,
+    interface::bitcoind_wallet>;
+
+template <typename Interface, size_t Index = zero>
+static constexpr size_t ordinal() NOEXCEPT
+{
+    static_assert(Index < std::tuple_size_v<subgroups>, "not a subgroup");
+    if constexpr (std::is_same_v<Interface,
+        std::tuple_element_t<Index, subgroups>>)
+        return Index;
+    else
+        return ordinal<Interface, add1(Index)>();
+}
+
+template <typename Interface>
+static void add_methods(method_router::table& out) NOEXCEPT
+{
+    std::apply([&out](const auto&... method) NOEXCEPT
+    {
+        (out.emplace(std::string{ method.name }, ordinal<Interface>()), ...);
+    }, Interface::methods);
+}
+
+// Merged once from the interface method tuples (subgroup names are disjoint).
+const method_router::table& protocol_bitcoind::subgroup_methods() NOEXCEPT
+{
+    static const auto table = []<size_t... Index>(
+        std::index_sequence<Index...>) NOEXCEPT
+    {
+        method_router::table out{};
+        (add_methods<std::tuple_element_t<Index, subgroups>>(out), ...);
+        return out;
+    }(std::make_index_sequence<std::tuple_size_v<subgroups>>{});
+
+    return table;
+}
+
 #define TEMPLATE template <typename Interface>
 #define CLASS protocol_bitcoind_dispatch<Interface>
 
-BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-
-// Subscribe to the post and websocket transports of the interface.
+// Set the route of the interface on the channel (terminal router dispatches).
 TEMPLATE
 void CLASS::start() NOEXCEPT
 {
@@ -42,11 +92,8 @@ void CLASS::start() NOEXCEPT
     // Publish served method names (e.g. for control subgroup help).
     register_methods(Interface::names);
 
-    using unknown = network::http::method::unknown;
-    subscribe_channel<CLASS, post>(&CLASS::handle_receive_post,
-        std::placeholders::_1, std::placeholders::_2);
-    subscribe_channel<CLASS, unknown>(&CLASS::handle_receive_unknown,
-        std::placeholders::_1, std::placeholders::_2);
+    using namespace std::placeholders;
+    router().set(ordinal<Interface>(), BIND(dispatch, _1, _2));
     network::protocol::start();
 }
 
@@ -54,95 +101,26 @@ TEMPLATE
 void CLASS::stopping(const code& ec) NOEXCEPT
 {
     BC_ASSERT(stranded());
+    stopping_.store(true);
     rpc_dispatcher_.stop(ec);
     network::protocol_http::stopping(ec);
 }
 
-// The post transport of the interface subgroup.
-TEMPLATE
-void CLASS::handle_receive_post(const code& ec,
-    const post::cptr& post) NOEXCEPT
-{
-    BC_ASSERT(stranded());
-
-    if (stopped(ec))
-        return;
-
-    // A protocol attached earlier owns the method (overrides this one).
-    if (claimed())
-        return;
-
-    // Silently defer invalidated requests to the terminal responder.
-    if (!is_allowed_host(*post, post->version()) ||
-        !is_allowed_origin(*post, post->version()) ||
-        !post->body().template contains<network::rpc::request>())
-        return;
-
-    // Get the parsed json-rpc request object.
-    const auto& message =
-        post->body().template get<network::rpc::request>().message;
-
-    // Silently defer methods not defined by the interface subgroup.
-    if (!rpc_dispatcher::contains(message.method))
-        return;
-
-    // Claim the request (informs the terminal responder).
-    set_claimed();
-
-    // The post is saved off during asynchonous handling and used in
-    // send_json to formulate response headers, isolating handlers from
-    // http semantics.
-    set_rpc_request(message.jsonrpc, message.id, post);
-
-    // The credential may be restricted to a subset of interface methods.
-    if (!permitted(message.method))
-    {
-        send_error(error::method_unauthorized);
-        return;
-    }
-
-    // Dispatch the request to the interface dispatcher.
-    if (const auto code = rpc_dispatcher_.notify(message))
-        stop(code);
-}
-
-// The websocket transport of the interface subgroup.
+// The route of the interface subgroup. The request is validated (host, origin,
+// authorization, permission) by the terminal router.
 TEMPLATE
-void CLASS::dispatch_websocket(
-    const network::http::request& request) NOEXCEPT
+void CLASS::dispatch(const network::rpc::request_t& message,
+    const network::http::request_cptr& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    // A protocol attached earlier owns the method (overrides this one).
-    if (claimed())
-        return;
-
-    // ws frames carry no headers, so ws authorization is enforced here,
-    // not by the channel. Unauthorized and non-rpc frames are silently
-    // deferred to the terminal responder (which stops the channel).
-    if (!authorized() ||
-        !request.body().template contains<network::rpc::request>())
-        return;
-
-    const auto& message =
-        request.body().template get<network::rpc::request>().message;
-
-    // Silently defer methods not defined by the interface subgroup.
-    if (!rpc_dispatcher::contains(message.method))
-        return;
-
-    // Claim the request (informs the terminal responder).
-    set_claimed();
-
-    // Cache request context for response building (version + id).
-    set_rpc_request(message);
-
-    // The credential may be restricted to a subset of interface methods.
-    if (!permitted(message.method))
-    {
-        send_error(error::method_unauthorized);
-        return;
-    }
+    // The post is saved off during asynchonous handling and used in send_json
+    // to formulate response headers, isolating handlers from http semantics.
+    // Websocket messages have no http request to echo headers from.
+    if (request)
+        set_rpc_request(message.jsonrpc, message.id, request);
+    else
+        set_rpc_request(message);
 
     // Dispatch the request to the interface dispatcher.
     if (const auto code = rpc_dispatcher_.notify(message))
@@ -23,6 +23,7 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 
@@ -115,27 +116,19 @@ bool protocol_bitcoind_mining::handle_get_mining_info(const code& ec,
     if (stopped(ec))
         return false;
 
-    const auto& query = archive();
-    const auto height = query.get_top_confirmed();
-    const auto link = query.to_confirmed(height);
-    const auto top = query.get_header(link);
-    if (!top)
-    {
-        send_error(database::error::integrity);
-        return true;
-    }
-
     // The pool state over the top block carries the next work required.
+    const auto& query = archive();
     const auto& bitcoin = system_settings();
-    const auto key = query.get_header_key(link);
-    const auto state = query.get_chain_state(bitcoin, key);
-    if (!state)
+    const auto next = server().states().get(query, bitcoin);
+    const auto top = next ? query.get_header(next->link) : header::cptr{};
+    if (!top)
     {
         send_error(database::error::integrity);
         return true;
     }
 
-    const chain_state pool{ *state, bitcoin };
+    const auto& pool = *next->state;
+    const auto height = sub1(pool.height());
     const header header{ 0, {}, {}, 0, pool.work_required(), 0 };
     object_t next_block
     {
@@ -20,6 +20,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <string>
+#include <string_view>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
@@ -103,6 +105,7 @@ void protocol_bitcoind_rest::handle_receive_get(const code& ec,
     // The get is saved off during asynchonous handling and used in send_json
     // to formulate response headers, isolating handlers from http semantics.
     set_request(get);
+    set_conditions(*get);
 
     // Parse the REST url into a json-rpc model and dispatch to a handler.
     request_t model{};
@@ -160,7 +163,11 @@ bool protocol_bitcoind_rest::handle_get_block(const code& ec,
 
     constexpr auto witness = true;
     const auto& query = archive();
-    const auto block = query.get_block(query.to_header(*hash), witness);
+    const auto link = query.to_header(*hash);
+    if (validate("block", *hash, link, {}, media))
+        return true;
+
+    const auto block = query.get_block(link, witness);
     if (!block)
     {
         send_not_found();
@@ -232,7 +239,11 @@ bool protocol_bitcoind_rest::handle_get_block_txs(const code& ec,
 
     constexpr auto witness = true;
     const auto& query = archive();
-    const auto block = query.get_block(query.to_header(*hash), witness);
+    const auto link = query.to_header(*hash);
+    if (validate("block_txs", *hash, link, {}, media))
+        return true;
+
+    const auto block = query.get_block(link, witness);
     if (!block)
     {
         send_not_found();
@@ -362,9 +373,14 @@ bool protocol_bitcoind_rest::handle_get_block_part(const code& ec,
         return true;
     }
 
+    const auto params = std::to_string(offset) + "/" + std::to_string(size);
     constexpr auto witness = true;
     const auto& query = archive();
-    const auto block = query.get_block(query.to_header(*hash), witness);
+    const auto link = query.to_header(*hash);
+    if (validate("block_part", *hash, link, params, media))
+        return true;
+
+    const auto block = query.get_block(link, witness);
     if (!block)
     {
         send_not_found();
@@ -411,7 +427,11 @@ bool protocol_bitcoind_rest::handle_get_block_spent_tx_outputs(const code& ec,
 
     constexpr auto witness = true;
     const auto& query = archive();
-    const auto block = query.get_block(query.to_header(*hash), witness);
+    const auto link = query.to_header(*hash);
+    if (validate("block_spent_tx_outputs", *hash, link, {}, media))
+        return true;
+
+    const auto block = query.get_block(link, witness);
     if (!block)
     {
         send_not_found();
@@ -479,9 +499,13 @@ bool protocol_bitcoind_rest::handle_get_block_filter(const code& ec,
         return true;
     }
 
+    const auto link = query.to_header(*hash);
+    if (validate("block_filter", *hash, link, {}, media))
+        return true;
+
     // libbitcoin stores only the neutrino (basic) filter; type is ignored.
     data_chunk filter{};
-    if (!query.get_filter_body(filter, query.to_header(*hash)))
+    if (!query.get_filter_body(filter, link))
     {
         send_not_found();
         return true;
@@ -521,8 +545,12 @@ bool protocol_bitcoind_rest::handle_get_block_filter_headers(const code& ec,
         return true;
     }
 
+    const auto link = query.to_header(*hash);
+    if (validate("block_filter_headers", *hash, link, {}, media))
+        return true;
+
     hash_digest filter_head{};
-    if (!query.get_filter_head(filter_head, query.to_header(*hash)))
+    if (!query.get_filter_head(filter_head, link))
     {
         send_not_found();
         return true;
@@ -588,12 +616,21 @@ void protocol_bitcoind_rest::send_data(data_chunk&& bytes) NOEXCEPT
     using namespace http;
     static const auto data = from_media_type(
         media_type::application_octet_stream);
+    std::string encoded{};
+    const auto coding = encode(encoded,
+        { pointer_cast<const char>(bytes.data()), bytes.size() });
+
     const auto request = reset_request();
     http::response message{ status::ok, request->version() };
     add_common_headers(message, *request);
     add_access_control_headers(message, *request);
+    add_encoding_headers(message, coding);
+    add_validator_headers(message);
     message.set(http::field::content_type, data);
-    message.body() = std::move(bytes);
+    if (coding == content_coding::identity)
+        message.body() = std::move(bytes);
+    else
+        message.body() = std::move(encoded);
     message.prepare_payload();
     SEND(std::move(message), handle_complete, _1, error::success);
 }
@@ -601,28 +638,29 @@ void protocol_bitcoind_rest::send_data(data_chunk&& bytes) NOEXCEPT
 void protocol_bitcoind_rest::send_text(std::string&& text) NOEXCEPT
 {
     BC_ASSERT(stranded());
-    using namespace http;
-    static const auto plain = from_media_type(media_type::text_plain);
-    const auto request = reset_request();
-    http::response message{ status::ok, request->version() };
-    add_common_headers(message, *request);
-    add_access_control_headers(message, *request);
-    message.set(field::content_type, plain);
-    message.body() = std::move(text);
-    message.prepare_payload();
-    SEND(std::move(message), handle_complete, _1, error::success);
+    send_string(std::move(text), http::media_type::text_plain);
 }
 
+// Serialized for compression only if the size hint warrants it.
 void protocol_bitcoind_rest::send_json(value&& model,
     size_t size_hint) NOEXCEPT
 {
     BC_ASSERT(stranded());
     using namespace http;
+    if (encoding(size_hint) != content_coding::identity)
+    {
+        send_string(boost::json::serialize(model),
+            media_type::application_json);
+        return;
+    }
+
     static const auto json = from_media_type(media_type::application_json);
     const auto request = reset_request();
     http::response message{ status::ok, request->version() };
     add_common_headers(message, *request);
     add_access_control_headers(message, *request);
+    add_encoding_headers(message, content_coding::identity);
+    add_validator_headers(message);
     message.set(field::content_type, json);
     message.body() = json_value
     {
@@ -636,6 +674,58 @@ void protocol_bitcoind_rest::send_json(value&& model,
 // private
 // ----------------------------------------------------------------------------
 
+void protocol_bitcoind_rest::send_string(std::string&& serialized,
+    http::media_type type) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    using namespace http;
+    std::string encoded{};
+    const auto coding = encode(encoded, serialized);
+
+    const auto request = reset_request();
+    http::response message{ status::ok, request->version() };
+    add_common_headers(message, *request);
+    add_access_control_headers(message, *request);
+    add_encoding_headers(message, coding);
+    add_validator_headers(message);
+    message.set(field::content_type, from_media_type(type));
+    if (coding == content_coding::identity)
+        message.body() = std::move(serialized);
+    else
+        message.body() = std::move(encoded);
+    message.prepare_payload();
+    SEND(std::move(message), handle_complete, _1, error::success);
+}
+
+// A presented tag is matched before block access (tags imply immutability),
+// and a wildcard or untagged response only if the block is deep-confirmed.
+bool protocol_bitcoind_rest::validate(std::string_view method,
+    const hash_digest& hash, const database::header_link& link,
+    std::string_view params, uint8_t media) NOEXCEPT
+{
+    const auto tag = entity_tag("rest", method, hash, params,
+        static_cast<http::media_type>(media));
+
+    if (is_not_modified(tag))
+    {
+        send_not_modified(tag, *reset_request());
+        return true;
+    }
+
+    if (!is_immutable(link))
+        return false;
+
+    // The block is now known to exist, so a wildcard also matches.
+    if (is_not_modified(tag, true))
+    {
+        send_not_modified(tag, *reset_request());
+        return true;
+    }
+
+    set_immutable(tag);
+    return false;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -70,7 +70,7 @@ void protocol_bitcoind_transaction::start() NOEXCEPT
     SUBSCRIBE_BITCOIND(handle_utxo_update_psbt, _1, _2);
     SUBSCRIBE_BITCOIND(handle_abort_private_broadcast, _1, _2);
     SUBSCRIBE_BITCOIND(handle_get_private_broadcast_info, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_submit_package, _1, _2);
+    SUBSCRIBE_BITCOIND(handle_submit_package, _1, _2, _3, _4, _5);
     protocol_bitcoind_dispatch<rpc_interface>::start();
 }
 
@@ -440,14 +440,110 @@ bool protocol_bitcoind_transaction::handle_get_private_broadcast_info(const code
     return true;
 }
 
+// Fee rate and burn limits are not applicable (no fee policy).
 bool protocol_bitcoind_transaction::handle_submit_package(const code& ec,
-    rpc_interface::submit_package) NOEXCEPT
+    rpc_interface::submit_package, const array_t& package_txs,
+    double, double) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    const auto package = std::make_shared<tx_package>();
+    if (const auto code = parse_package(package->txs, package_txs))
+    {
+        send_error(code);
+        return true;
+    }
+
+    const auto deferred = defer("submitpackage");
+    if (!deferred)
+    {
+        send_error(error::server_busy);
+        return true;
+    }
+
+    // Transactions are validated concurrently, children against the
+    // outputs of their in-package parents (populated here).
+    const auto count = package->txs.size();
+    package->faults.resize(count);
+    package->remaining.store(count);
+    populate_package(package->txs);
+
+    monitor(true);
+    for (size_t index{}; index < count; ++index)
+        PARALLEL(do_submit_package, package, index, deferred);
+
     return true;
 }
 
+void protocol_bitcoind_transaction::do_submit_package(
+    const tx_package::ptr& package, size_t index,
+    const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+
+    // The package is relayed only once all are validated.
+    package->faults.at(index) = stopping_ ? network::error::channel_stopped :
+        validate_tx(*package->txs.at(index));
+
+    if (is_one(package->remaining.fetch_sub(one)))
+        POST(complete_submit_package, package, deferred);
+}
+
+void protocol_bitcoind_transaction::complete_submit_package(
+    const tx_package::ptr& package, const deferred_ptr& deferred) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (stopped())
+    {
+        complete_deferred(network::error::channel_stopped, deferred);
+        return;
+    }
+
+    // A child is not accepted without its in-package parent.
+    reject_orphans(*package);
+
+    size_t size{};
+    object_t results{};
+    for (size_t index{}; index < package->txs.size(); ++index)
+    {
+        // Accepted transactions are relayed in topological order.
+        const auto& tx = package->txs.at(index);
+        const auto& fault = package->faults.at(index);
+        object_t result{ { "txid", encode_hash(tx->hash(false)) } };
+        if (fault)
+        {
+            const auto message = fault.message();
+            size += message.size();
+            result.emplace("error", message);
+        }
+        else
+        {
+            relay_tx(tx);
+        }
+
+        size += 4 * two * system::hash_size;
+        results.emplace(encode_hash(tx->hash(true)), std::move(result));
+    }
+
+    const auto success = std::all_of(package->faults.begin(),
+        package->faults.end(), [](const code& fault) NOEXCEPT
+        {
+            return !fault;
+        });
+
+    const string_t message{ success ? "success" : "transaction failed" };
+    deferred->size_hint = 96 + size;
+    deferred->result = object_t
+    {
+        { "package_msg", message },
+        { "tx-results", std::move(results) },
+        { "replaced-transactions", array_t{} }
+    };
+
+    complete_deferred(error::success, deferred);
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
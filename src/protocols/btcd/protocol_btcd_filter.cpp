@@ -79,6 +79,7 @@ bool protocol_btcd::handle_load_tx_filter(const code& ec,
     return true;
 }
 
+// Watches are matched against each connected block (not primed by query).
 void protocol_btcd::do_load_tx_filter(bool reload, const hashes& keys,
     const chain::points& points) NOEXCEPT
 {
@@ -90,58 +91,37 @@ void protocol_btcd::do_load_tx_filter(bool reload, const hashes& keys,
         outpoint_watches_.clear();
     }
 
-    histories discard{};
     code ec{ error::success };
-    const auto& query = archive();
     const auto maximum = server_settings().btcd.maximum_filters;
-    const auto limit = server_settings().btcd.maximum_history;
+    const auto full = [&]() NOEXCEPT
+    {
+        return ceilinged_add(address_watches_.size(),
+            outpoint_watches_.size()) >= maximum;
+    };
 
     for (const auto& key: keys)
     {
-        if (stopping_)
-            return;
-
-        if (ceilinged_add(address_watches_.size(), outpoint_watches_.size()) >=
-            maximum)
+        if (!address_watches_.contains(key) && full())
         {
             ec = error::subscription_limit;
             break;
         }
 
-        // Prime the cursor to present, so matching reports new blocks only.
-        const auto at = address_watches_.try_emplace(key, address_watch{});
-        if (at.second)
-        {
-            const auto fault = query.get_history(stopping_,
-                at.first->second.cursor, discard, key, limit, turbo_);
-            if (fault == database::error::query_canceled)
-                return;
-        }
+        address_watches_.insert(key);
     }
 
     for (const auto& prevout: points)
     {
-        if (stopping_)
-            return;
-
         if (ec)
             break;
 
-        if (ceilinged_add(address_watches_.size(), outpoint_watches_.size()) >=
-            maximum)
+        if (!outpoint_watches_.contains(prevout) && full())
         {
             ec = error::subscription_limit;
             break;
         }
 
-        // Prime the spender set to present, so matching reports new only.
-        const auto at = outpoint_watches_.try_emplace(prevout, outpoint_watch{});
-        if (at.second)
-        {
-            auto& sub = at.first->second;
-            sub.outpoint = query.get_tx_history(query.to_tx(prevout.hash()));
-            sub.spenders = query.get_spenders_history(prevout);
-        }
+        outpoint_watches_.insert(prevout);
     }
 
     POST_BTCD(complete_load_tx_filter, ec);
@@ -207,82 +187,47 @@ void protocol_btcd::do_rescan_blocks(const hashes_ptr& block_hashes) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    hashes keys{};
-    keys.reserve(address_watches_.size());
-    for (const auto& watch: address_watches_)
-        keys.push_back(watch.first);
-
-    chain::points points{};
-    points.reserve(outpoint_watches_.size());
-    for (const auto& watch: outpoint_watches_)
-        points.push_back(watch.first);
-
-    PARALLEL(do_rescan_watches, block_hashes, std::move(keys),
-        std::move(points));
+    PARALLEL(do_rescan_watches, block_hashes, address_watches_,
+        outpoint_watches_);
 }
 
 void protocol_btcd::do_rescan_watches(const hashes_ptr& block_hashes,
-    const hashes& keys, chain::points& points) NOEXCEPT
+    const scripthash_set& keys, const point_set& points) NOEXCEPT
 {
     BC_ASSERT(!stranded());
 
-    sizes heights{};
     const auto& query = archive();
-    std::vector<std::pair<hash_digest, size_t>> named{};
+    std::vector<database::header_link> links{};
+    links.reserve(block_hashes->size());
 
-    // Resolve named blocks to heights (result retains request order).
-    for (auto& hash: *block_hashes)
+    // Resolve named blocks (result retains request order).
+    for (const auto& hash: *block_hashes)
     {
-        if (stopping_)
-            return;
-
-        size_t height{};
-        if (!query.get_height(height, query.to_header(hash)))
+        const auto link = query.to_header(hash);
+        if (link.is_terminal())
         {
             POST_BTCD(complete_rescan_blocks, error::not_found,
                 to_shared<array_t>());
             return;
         }
 
-        heights.insert(height);
-        named.emplace_back(std::move(hash), height);
-    }
-
-    // Match the snapshot against the named heights (full replay).
-    matches matched{};
-    for (const auto& key: keys)
-    {
-        if (stopping_)
-            return;
-
-        address_watch replay{};
-        const auto fault = match_addresses(matched, replay, key, heights);
-        if (fault == database::error::query_canceled)
-            return;
-    }
-
-    for (const auto& prevout: points)
-    {
-        if (stopping_)
-            return;
-
-        outpoint_watch replay{};
-        match_outpoints(matched, replay, prevout, heights);
+        links.push_back(link);
     }
 
+    // Match the snapshot against each named block (one block read each).
     array_t discovered{};
-    for (const auto& [hash, height]: named)
+    for (size_t index{}; index < links.size(); ++index)
     {
         if (stopping_)
             return;
 
-        const auto at = matched.find(height);
-        if (at != matched.end() && !at->second.empty())
+        const auto txs = match_block(links.at(index), keys, points);
+        if (!txs.empty())
         {
             discovered.emplace_back(object_t
             {
-                { "hash", encode_hash(hash) },
-                { "transactions", serialize_matches(at->second) }
+                { "hash", encode_hash(block_hashes->at(index)) },
+                { "transactions", serialize_matches(txs) }
             });
         }
     }
@@ -327,45 +272,16 @@ void protocol_btcd::do_connected(node::header_t link_value) NOEXCEPT
     if (!header)
         return;
 
-    // Match the watch-list against the connected block (cursored delta).
-    // Cursors advance here, so this stays on the notification strand.
-    matches matched{};
-    const sizes heights{ height };
-    for (auto& [key, sub]: address_watches_)
-    {
-        if (stopping_)
-            return;
-
-        const auto fault = match_addresses(matched, sub, key, heights);
-        if (fault == database::error::query_canceled)
-            return;
-    }
-
-    for (auto& [prevout, sub]: outpoint_watches_)
-    {
-        if (stopping_)
-            return;
-
-        match_outpoints(matched, sub, prevout, heights);
-    }
-
-    array_t txs{};
-    const auto at = matched.find(height);
-    if (at != matched.end())
-        txs = serialize_matches(at->second);
-
+    // Match the watch-list against the connected block (one block read).
+    const auto txs = match_block(link, address_watches_, outpoint_watches_);
     POST_BTCD(notify_connected, header, height,
-        emplace_shared<array_t>(std::move(txs)));
+        emplace_shared<array_t>(serialize_matches(txs)));
 }
 
 void protocol_btcd::do_disconnected(node::header_t link_value) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    // Reset watch cursors, disconnected blocks invalidate the walks.
-    for (auto& [key, sub]: address_watches_)
-        sub.cursor = {};
-
     const database::header_link link{ link_value };
     const auto& query = archive();
 
@@ -426,53 +342,36 @@ void protocol_btcd::notify_disconnected(const header_cptr& header,
 // ----------------------------------------------------------------------------
 
 // Called from notification strand (live) and parallel (rescan).
-code protocol_btcd::match_addresses(matches& out, address_watch& sub,
-    const hash_digest& key, const sizes& heights) NOEXCEPT
+// The block is decoded once, its scripts hashed and prevouts probed against
+// the watch sets. Prevouts are populated only for address watches, and where
+// not found cannot match (a spend of a watched outpoint is still matched).
+chain::transaction_cptrs protocol_btcd::match_block(
+    const database::header_link& link, const scripthash_set& keys,
+    const point_set& points) const NOEXCEPT
 {
-    histories delta{};
-    const auto& query = archive();
-    const auto limit = server_settings().btcd.maximum_history;
-    if (const auto ec = query.get_history(stopping_, sub.cursor, delta, key,
-        limit, turbo_); ec)
-        return ec;
+    if (keys.empty() && points.empty())
+        return {};
 
-    for (const auto& entry: delta)
-        if (entry.confirmed() && heights.contains(entry.tx.height()))
-            out[entry.tx.height()].emplace(entry.position, entry.tx.hash());
-
-    return error::success;
-}
-
-// Called from notification strand (live) and parallel (rescan).
-void protocol_btcd::match_outpoints(matches& out, outpoint_watch& sub,
-    const point& prevout, const sizes& heights) NOEXCEPT
-{
-    outpoint_watch next{};
+    constexpr auto witness = true;
     const auto& query = archive();
-    next.outpoint = query.get_tx_history(query.to_tx(prevout.hash()));
-    next.spenders = query.get_spenders_history(prevout);
+    const auto block = query.get_block(link, witness);
+    if (!block)
+        return {};
 
-    for (const auto& spender: difference(next.spenders, sub.spenders))
-        if (spender.confirmed() && heights.contains(spender.tx.height()))
-            out[spender.tx.height()].emplace(spender.position,
-                spender.tx.hash());
+    if (!keys.empty())
+        query.populate_without_metadata(*block);
 
-    sub = std::move(next);
+    return btcd::filter_block(*block, keys, points);
 }
 
-array_t protocol_btcd::serialize_matches(const matched_txs& txs) NOEXCEPT
+array_t protocol_btcd::serialize_matches(
+    const chain::transaction_cptrs& txs) NOEXCEPT
 {
     array_t out{};
+    out.reserve(txs.size());
     constexpr auto witness = true;
-    const auto& query = archive();
-    for (const auto& [position, hash]: txs)
-    {
-        if (stopping_)
-            return out;
-
-        if (const auto tx = query.get_transaction(query.to_tx(hash), witness); tx)
-            out.emplace_back(to_text(*tx, tx->serialized_size(witness), witness));
-    }
+    for (const auto& tx: txs)
+        out.emplace_back(to_text(*tx, tx->serialized_size(witness), witness));
 
     return out;
 }
@@ -23,6 +23,7 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_rpc.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -81,11 +82,12 @@ void protocol_electrum::start() NOEXCEPT
 
     // Scripthash methods.
     SUBSCRIBE_RPC(handle_blockchain_scripthash_get_balance, _1, _2, _3);
-    SUBSCRIBE_RPC(handle_blockchain_scripthash_get_history, _1, _2, _3);
+    SUBSCRIBE_RPC(handle_blockchain_scripthash_get_history, _1, _2, _3, _4);
     SUBSCRIBE_RPC(handle_blockchain_scripthash_get_mempool, _1, _2, _3);
     SUBSCRIBE_RPC(handle_blockchain_scripthash_list_unspent, _1, _2, _3);
     SUBSCRIBE_RPC(handle_blockchain_scripthash_subscribe, _1, _2, _3);
     SUBSCRIBE_RPC(handle_blockchain_scripthash_unsubscribe, _1, _2, _3);
+    SUBSCRIBE_RPC(handle_blockchain_scripthash_subscribe_many, _1, _2, _3);
 
     // Scriptpubkey methods.
     SUBSCRIBE_RPC(handle_blockchain_scriptpubkey_get_balance, _1, _2, _3);
@@ -123,6 +125,11 @@ void protocol_electrum::stopping(const code& ec) NOEXCEPT
     BC_ASSERT(stranded());
     stopping_.store(true);
     unsubscribe_chase();
+
+    // Subscribers test stopping_ after indexing, so none can be orphaned.
+    server().scripthashes().unsubscribe(identifier());
+    server().outpoints().unsubscribe(identifier());
+    POST_NOTIFY(do_release_subscriptions, ec);
     protocol_rpc<channel_electrum>::stopping(ec);
 }
 
@@ -156,14 +163,26 @@ bool protocol_electrum::handle_chase(const code&, node::chase event_,
             if (subscribed_outpoint_.load(relaxed))
             {
                 BC_ASSERT(std::holds_alternative<node::header_t>(value));
-                POST_NOTIFY(do_outpoint, std::get<node::header_t>(value));
+
+                // Only an organized block is reduced to its touched outpoints.
+                if (event_ == node::chase::organized)
+                    POST_NOTIFY(do_outpoint, std::get<node::header_t>(value));
+                else
+                    POST_NOTIFY(do_outpoint_all,
+                        std::get<node::header_t>(value));
             }
 
             if (subscribed_address_.load(relaxed))
             {
                 BC_ASSERT(archive().address_enabled());
                 BC_ASSERT(std::holds_alternative<node::header_t>(value));
-                POST_NOTIFY(do_scripthash, std::get<node::header_t>(value));
+
+                // Only an organized block is reduced to its touched keys.
+                if (event_ == node::chase::organized)
+                    POST_NOTIFY(do_scripthash, std::get<node::header_t>(value));
+                else
+                    POST_NOTIFY(do_scripthash_all,
+                        std::get<node::header_t>(value));
             }
 
             break;
@@ -186,21 +205,64 @@ bool protocol_electrum::handle_chase(const code&, node::chase event_,
 
 // reorganization
 // ----------------------------------------------------------------------------
-// outpoint subscriptions do not require modification.
+// outpoint subscriptions are requeried on the next organized block.
 
-// The chain has been reduced in height, clear all midstate cache and cursors.
+// The chain has been reduced in height. Shared midstates are rewound once by
+// the server node (before channels are notified). Keys touched by popped
+// blocks are unknown, so all are requeried on the next organized block.
 void protocol_electrum::do_reorganized(node::header_t) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
+    // Cleared status ensures notification of the refolded status.
+    rescan_ = true;
+    rescan_outpoints_ = true;
+    ++reorganizations_;
     for (auto& [key, sub]: address_subscriptions_)
-    {
-        // Reset (not flush) the accumulator to its initial (IV) state; flush()
-        // pads in place, leaving non-IV state that would poison re-accumulation.
-        sub.accumulator.reset();
         sub.status = {};
-        sub.cursor = {};
+}
+
+// subscription tables
+// ----------------------------------------------------------------------------
+
+// Replace this channel's contribution to the server-wide totals. Once
+// stopping, the contribution is retracted (tables are or will be released).
+void protocol_electrum::report_usage() NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    subscription_usage::totals current{};
+    if (!stopping_.load())
+    {
+        current.subscriptions = address_subscriptions_.size() +
+            outpoint_subscriptions_.size();
+        current.bytes = address_subscriptions_.memory() +
+            outpoint_subscriptions_.memory();
+
+        // Spender histories are heap owned by outpoint table entries.
+        for (const auto& [point, sub]: outpoint_subscriptions_)
+            current.bytes += sub.spenders.capacity() *
+                sizeof(database::history);
     }
+
+    server().usage().update(usage_, current);
+    usage_ = current;
+}
+
+// Free all subscription state in bulk (slot arrays) when the channel stops.
+void protocol_electrum::do_release_subscriptions(const code&) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    auto& cache = server().statuses();
+    for (const auto& [key, sub]: address_subscriptions_)
+        cache.unsubscribe(key);
+
+    address_subscriptions_.release();
+    outpoint_subscriptions_.release();
+    subscribed_address_.store(false, relaxed);
+    subscribed_outpoint_.store(false, relaxed);
+    report_usage();
 }
 
 BC_POP_WARNING()
@@ -63,7 +63,7 @@ void protocol_electrum::handle_blockchain_address_get_history(const code& ec,
         return;
     }
 
-    get_history(extract_scripthash(address));
+    get_history(extract_scripthash(address), zero);
 }
 
 void protocol_electrum::handle_blockchain_address_get_mempool(const code& ec,
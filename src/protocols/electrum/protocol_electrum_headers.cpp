@@ -22,6 +22,7 @@
 #include <ranges>
 #include <variant>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -316,12 +317,12 @@ void protocol_electrum::blockchain_block_headers(size_t starting,
         if (prove)
         {
             // A very slim chance of inconsistency given an intervening reorg
-            // because of get_merkle_root_and_proof() and height-based calcs.
+            // because of get_root_and_proof() and height-based calcs.
             // This is acceptable as must be verified by caller in any case.
             hashes proof{};
             hash_digest root{};
-            if (const auto code = query.get_merkle_root_and_proof(root, proof,
-                target, waypoint))
+            if (const auto code = server().headers().get_root_and_proof(root,
+                proof, query, target, waypoint))
             {
                 send_code(code);
                 return;
@@ -432,10 +433,9 @@ void protocol_electrum::do_height(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    const auto& query = archive();
-    const auto height = query.get_height(link);
-
-    if (height.is_terminal())
+    // Shared by all channels notified of the same block.
+    const auto notice = server().notices().get(archive(), link);
+    if (!notice)
     {
         LOGF("Electrum::do_height, height not found (" << link << ").");
         return;
@@ -446,7 +446,7 @@ void protocol_electrum::do_height(node::header_t link) NOEXCEPT
     // electrum.readthedocs.io/en/latest/protocol.html#blockchain-numblocks-subscribe
     send_notification("blockchain.numblocks.subscribe", value_t
     {
-        height.value
+        notice->height
     }, 48);
 }
 
@@ -455,11 +455,9 @@ void protocol_electrum::do_header(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    const auto& query = archive();
-    const auto height = query.get_height(link);
-    const auto header = query.get_wire_header(link);
-
-    if (height.is_terminal())
+    // Shared by all channels notified of the same block.
+    const auto notice = server().notices().get(archive(), link);
+    if (!notice)
     {
         LOGF("Electrum::do_header, header not found (" << link << ").");
         return;
@@ -469,8 +467,8 @@ void protocol_electrum::do_header(node::header_t link) NOEXCEPT
     {
         object_t
         {
-            { "height", height.value },
-            { "hex", encode_base16(header) }
+            { "height", notice->height },
+            { "hex", notice->hex }
         }
     }, 64);
 }
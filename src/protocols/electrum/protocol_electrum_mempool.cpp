@@ -18,7 +18,10 @@
  */
 #include <bitcoin/server/protocols/protocol_electrum.hpp>
 
+#include <algorithm>
+#include <utility>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -42,9 +45,39 @@ void protocol_electrum::handle_mempool_get_fee_histogram(const code& ec,
         return;
     }
 
-    // TODO: could be simulated with block fees.
-    send_result(array_t{}, 42);
-    ////send_code(error::not_implemented);
+    monitor(true);
+    PARALLEL(do_get_fee_histogram);
+}
+
+// There is no tx pool, so the histogram is simulated with top block fees. The
+// snapshot is computed once per block, so this is constant cost otherwise.
+void protocol_electrum::do_get_fee_histogram() NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+    POST(complete_get_fee_histogram, server().fees().get(archive()));
+}
+
+void protocol_electrum::complete_get_fee_histogram(
+    const fee_snapshot::bins_ptr& bins) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    monitor(false);
+    if (stopped())
+        return;
+
+    if (!bins)
+    {
+        send_code(error::server_error);
+        return;
+    }
+
+    array_t histogram(bins->size());
+    std::ranges::transform(*bins, histogram.begin(), [](const auto& bin) NOEXCEPT
+    {
+        return array_t{ bin.first, bin.second };
+    });
+
+    send_result(std::move(histogram), 42 + bins->size() * 32);
 }
 
 void protocol_electrum::handle_mempool_get_info(const code& ec,
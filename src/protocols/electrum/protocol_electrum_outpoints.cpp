@@ -160,8 +160,15 @@ void protocol_electrum::do_outpoint_subscribe(const point& prevout) NOEXCEPT
     {
         ec = error::success;
         get_outpoint_history(sub, prevout);
-        outpoint_subscriptions_.emplace(prevout, sub);
+        outpoint_subscriptions_.try_emplace(prevout, sub);
+        server().outpoints().subscribe(identifier(), prevout);
+
+        // Index after stopping_ may orphan the key, so test after.
         subscribed_outpoint_.store(true, relaxed);
+        if (stopping_.load())
+            server().outpoints().unsubscribe(identifier());
+
+        report_usage();
     }
 
     // All current subscribers are cached and forwarded.
@@ -236,6 +243,10 @@ void protocol_electrum::do_outpoint_unsubscribe(const point& prevout) NOEXCEPT
     if (is_zero(outpoint_subscriptions_.size()))
         subscribed_outpoint_.store(false, relaxed);
 
+    if (found)
+        server().outpoints().unsubscribe(identifier(), prevout);
+
+    report_usage();
     POST(complete_outpoint_unsubscribe, found);
 }
 
@@ -247,54 +258,59 @@ void protocol_electrum::complete_outpoint_unsubscribe(bool found) NOEXCEPT
 // notify
 // ----------------------------------------------------------------------------
 
-// Notifier for blockchain_outpoint_subscribe events.
-void protocol_electrum::do_outpoint(node::header_t) NOEXCEPT
+// Notifier for blockchain_outpoint_subscribe events (organized block).
+// Only subscriptions touched by the block (by created output or spent prevout)
+// are requeried, as intersected once per block by the server-wide index.
+void protocol_electrum::do_outpoint(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    for (auto& subscription: outpoint_subscriptions_)
+    // Outpoints touched by reorganization are unknown, requery all.
+    if (rescan_outpoints_)
+    {
+        rescan_outpoints_ = false;
+        do_outpoint_all(link);
+        return;
+    }
+
+    outpoint_index::keys keys{};
+    if (const auto ec = server().outpoints().touched(keys, archive(), link,
+        identifier()))
+    {
+        LOGF("Electrum::do_outpoint, " << ec.message());
+        do_outpoint_all(link);
+        return;
+    }
+
+    for (const auto& key: keys)
     {
         if (stopping_)
             return;
 
-        auto& sub = subscription.second;
-        const auto& prevout = subscription.first;
+        const auto it = outpoint_subscriptions_.find(key);
+        if (it != outpoint_subscriptions_.end())
+            update_outpoint(it->second, it->first);
+    }
 
-        outpoint_subscription out{};
-        if (!get_outpoint_history(out, prevout))
-        {
-            LOGV("Electrum::do_outpoint, outpoint not found.");
-            continue;
-        }
+    // Updated spenders change the heap owned by the table.
+    if (!keys.empty())
+        report_usage();
+}
 
-        // There is no change.
-        if (sub == out) continue;
+// Notifier for blockchain_outpoint_subscribe events (all subscriptions).
+void protocol_electrum::do_outpoint_all(node::header_t) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
 
-        const auto height = out.outpoint.tx.height();
-        if (!sub.outpoint.valid() || height != sub.outpoint.tx.height())
-        {
-            // Outpoint found or changed height, send all current spenders.
-            if (out.spenders.empty())
-            {
-                POST(outpoint_notify, make_status(height), prevout);
-            }
-            else for (const auto& spender: out.spenders)
-            {
-                POST(outpoint_notify, make_status(height, spender), prevout);
-            }
-        }
-        else
-        {
-            // Outpoint unchanged, send only new or changed spenders.
-            for (const auto& spender: difference(out.spenders, sub.spenders))
-            {
-                POST(outpoint_notify, make_status(height, spender), prevout);
-            }
-        }
+    for (auto& [prevout, sub]: outpoint_subscriptions_)
+    {
+        if (stopping_)
+            return;
 
-        // Update subscription state.
-        sub = std::move(out);
+        update_outpoint(sub, prevout);
     }
+
+    report_usage();
 }
 
 void protocol_electrum::outpoint_notify(const std::unique_ptr<object_t>& status,
@@ -350,6 +366,50 @@ object_t protocol_electrum::to_outpoint_status(
         to_outpoint_status(output_height, sub.spenders.front());
 }
 
+// protected
+// Update outpoint history and notify of changes.
+void protocol_electrum::update_outpoint(outpoint_subscription& sub,
+    const point& prevout) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    outpoint_subscription out{};
+    if (!get_outpoint_history(out, prevout))
+    {
+        LOGV("Electrum::update_outpoint, outpoint not found.");
+        return;
+    }
+
+    // There is no change.
+    if (sub == out)
+        return;
+
+    const auto height = out.outpoint.tx.height();
+    if (!sub.outpoint.valid() || height != sub.outpoint.tx.height())
+    {
+        // Outpoint found or changed height, send all current spenders.
+        if (out.spenders.empty())
+        {
+            POST(outpoint_notify, make_status(height), prevout);
+        }
+        else for (const auto& spender: out.spenders)
+        {
+            POST(outpoint_notify, make_status(height, spender), prevout);
+        }
+    }
+    else
+    {
+        // Outpoint unchanged, send only new or changed spenders.
+        for (const auto& spender: difference(out.spenders, sub.spenders))
+        {
+            POST(outpoint_notify, make_status(height, spender), prevout);
+        }
+    }
+
+    // Update subscription state.
+    sub = std::move(out);
+}
+
 // protected
 bool protocol_electrum::get_outpoint_history(outpoint_subscription& out,
     const point& prevout) const NOEXCEPT
@@ -107,10 +107,12 @@ void protocol_electrum::complete_get_balance(const code& ec,
 // get_history
 // ----------------------------------------------------------------------------
 // undocumented change in v1.6 (mempool canonical ordering, always ordered).
+// from_height is a server extension, returning only confirmed history at or
+// above the height (and all unconfirmed history), zero implies all history.
 
 void protocol_electrum::handle_blockchain_scripthash_get_history(const code& ec,
     rpc_interface::blockchain_scripthash_get_history,
-    const std::string& scripthash) NOEXCEPT
+    const std::string& scripthash, double from_height) NOEXCEPT
 {
     BC_ASSERT(stranded());
     if (stopped(ec))
@@ -122,13 +124,22 @@ void protocol_electrum::handle_blockchain_scripthash_get_history(const code& ec,
         return;
     }
 
+    size_t from{};
+    if (!to_integer(from, from_height) ||
+        from > database::height_link::terminal)
+    {
+        send_code(error::invalid_argument);
+        return;
+    }
+
     hash_digest hash{};
     decode_hash(hash, scripthash);
-    get_history(hash);
+    get_history(hash, from);
 }
 
 // common
-void protocol_electrum::get_history(const system::hash_digest& hash) NOEXCEPT
+void protocol_electrum::get_history(const system::hash_digest& hash,
+    size_t from_height) NOEXCEPT
 {
     BC_ASSERT(stranded());
     if (hash == null_hash)
@@ -144,18 +155,32 @@ void protocol_electrum::get_history(const system::hash_digest& hash) NOEXCEPT
     }
 
     monitor(true);
-    PARALLEL(do_get_history, hash);
+    PARALLEL(do_get_history, hash, from_height);
 }
 
-void protocol_electrum::do_get_history(const hash_digest& hash) NOEXCEPT
+void protocol_electrum::do_get_history(const hash_digest& hash,
+    size_t from_height) NOEXCEPT
 {
     BC_ASSERT(!stranded());
     histories histories{};
     database::height_link cursor{};
+
+    // Start the confirmed scan below from_height, so that the result is
+    // inclusive of it whether the cursor is taken as inclusive or exclusive.
+    if (!is_zero(from_height))
+        cursor = possible_narrow_cast<database::height_link::integer>(
+            sub1(from_height));
+
     const auto& query = archive();
     const auto ec = query.get_history(stopping_, cursor, histories, hash,
         options().maximum_history, turbo_);
 
+    // The limit applies to the delta, which excludes any history below.
+    std::erase_if(histories, [from_height](const auto& history) NOEXCEPT
+    {
+        return history.confirmed() && history.tx.height() < from_height;
+    });
+
     POST(complete_get_history, ec, std::move(histories));
 }
 
@@ -91,7 +91,7 @@ void protocol_electrum::handle_blockchain_scriptpubkey_get_history(
         return;
     }
 
-    get_history(script.hash());
+    get_history(script.hash(), zero);
 }
 
 void protocol_electrum::handle_blockchain_scriptpubkey_get_mempool(
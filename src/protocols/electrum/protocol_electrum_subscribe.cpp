@@ -18,7 +18,10 @@
  */
 #include <bitcoin/server/protocols/protocol_electrum.hpp>
 
+#include <algorithm>
+#include <ranges>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -71,6 +74,18 @@ void protocol_electrum::scripthash_subscribe(const hash_digest& hash,
 {
     BC_ASSERT(stranded());
 
+    const auto batch = std::make_shared<subscription_batch>();
+    batch->type = type;
+    batch->hashes.push_back(hash);
+    scripthash_subscribe(batch);
+}
+
+// common
+void protocol_electrum::scripthash_subscribe(
+    const subscription_batch_ptr& batch) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
     if (!archive().address_enabled())
     {
         send_code(error::not_implemented);
@@ -78,35 +93,192 @@ void protocol_electrum::scripthash_subscribe(const hash_digest& hash,
     }
 
     monitor(true);
-    POST_NOTIFY(do_scripthash_subscribe, hash, type);
+    POST_NOTIFY(do_scripthash_subscribe, batch);
 }
 
-void protocol_electrum::do_scripthash_subscribe(const hash_digest& hash,
-    notify_t type) NOEXCEPT
+// Existing subscriptions are updated in place, new subscriptions are queried
+// concurrently on the threadpool and merged back on the notification strand.
+void protocol_electrum::do_scripthash_subscribe(
+    const subscription_batch_ptr& batch) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    hash_digest status{};
-    code ec{ error::subscription_limit };
-    if (address_subscriptions_.size() < options().maximum_subscriptions)
+    code ec{};
+    for (const auto& hash: batch->hashes)
     {
-        const auto at = address_subscriptions_.try_emplace(hash,
-            address_subscription{ type });
-
-        // Initial subscription is limited by configured maximum history.
-        const auto limit = at.second ? options().maximum_history : max_size_t;
-        if ((ec = get_scripthash_history(at.first->second, at.first->first, limit)))
+        const auto it = address_subscriptions_.find(hash);
+        if (it == address_subscriptions_.end())
+        {
+            batch->pending.emplace_back(hash,
+                address_subscription{ batch->type });
+        }
+        else if ((ec = get_scripthash_status(it->second, hash, {})))
         {
-            if (at.second) address_subscriptions_.erase(at.first);
+            break;
         }
+    }
+
+    // Duplicated new keys are counted against the limit (conservative).
+    const auto count = address_subscriptions_.size() + batch->pending.size();
+    if (!ec && count > options().maximum_subscriptions)
+        ec = error::subscription_limit;
+
+    if (ec)
+    {
+        if (batch->many)
+            POST(complete_scripthash_subscribe_many, ec,
+                std::vector<hash_digest>{});
         else
+            POST(complete_scripthash_subscribe, ec, hash_digest{});
+
+        return;
+    }
+
+    if (batch->pending.empty())
+    {
+        merge_scripthash_subscribe(batch);
+        return;
+    }
+
+    // Events between here and merge are reconciled by merge.
+    batch->notifications = notifications_;
+    batch->reorganizations = reorganizations_;
+    POST(parallel_scripthash_subscribe, batch);
+}
+
+// Partition new subscriptions across a bounded number of threadpool tasks.
+void protocol_electrum::parallel_scripthash_subscribe(
+    const subscription_batch_ptr& batch) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped())
+    {
+        monitor(false);
+        return;
+    }
+
+    const auto total = batch->pending.size();
+    const auto tasks = std::min(total, maximum_subscription_tasks);
+    const auto slice = ceilinged_divide(total, tasks);
+    batch->remaining.store(ceilinged_divide(total, slice));
+
+    for (size_t first = 0; first < total; first += slice)
+        PARALLEL(do_scripthash_histories, batch, first,
+            std::min(first + slice, total));
+}
+
+// Each task owns its range of pending subscriptions, the last one merges.
+void protocol_electrum::do_scripthash_histories(
+    const subscription_batch_ptr& batch, size_t first, size_t last) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+
+    // Initial subscription is limited by configured maximum history. Each
+    // successful item holds a subscription to the shared status cache.
+    auto& cache = server().statuses();
+    const auto limit = options().maximum_history;
+    for (auto index = first; index < last; ++index)
+    {
+        auto& item = batch->pending.at(index);
+        item.ec = cache.subscribe(item.sub.status, archive(), stopping_,
+            item.hash, limit, turbo_);
+    }
+
+    if (is_one(batch->remaining.fetch_sub(one)))
+        POST_NOTIFY(merge_scripthash_subscribe, batch);
+}
+
+void protocol_electrum::merge_scripthash_subscribe(
+    const subscription_batch_ptr& batch) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    const auto reorganized = batch->reorganizations != reorganizations_;
+    const auto notified = batch->notifications != notifications_;
+    auto& cache = server().statuses();
+
+    // Once stopping the tables are (or will be) released, so merge nothing.
+    code ec{};
+    if (stopping_.load())
+        ec = network::error::channel_stopped;
+
+    // Hashes merged by this batch, released if a later item fails.
+    std::vector<hash_digest> merged{};
+    merged.reserve(batch->pending.size());
+
+    for (auto& item: batch->pending)
+    {
+        // Release the cache subscription of each item that is not merged.
+        if (ec || (ec = item.ec))
+        {
+            if (!item.ec)
+                cache.unsubscribe(item.hash);
+
+            continue;
+        }
+
+        const auto at = address_subscriptions_.try_emplace(item.hash,
+            std::move(item.sub));
+
+        // Duplicated key within the request.
+        if (!at.second)
+        {
+            cache.unsubscribe(item.hash);
+            continue;
+        }
+
+        // Shared state is rewound by reorganization, so update from it.
+        // Otherwise only events that occurred since the query are applied.
+        auto& sub = at.first->second;
+        if (reorganized || notified)
+            ec = get_scripthash_status(sub, item.hash, {});
+
+        if (ec)
         {
-            status = at.first->second.status;
-            subscribed_address_.store(true, relaxed);
+            address_subscriptions_.erase(at.first);
+            cache.unsubscribe(item.hash);
+            continue;
+        }
+
+        merged.push_back(item.hash);
+    }
+
+    // The request fails as a whole, so no item of it remains subscribed.
+    if (ec)
+    {
+        for (const auto& hash: merged)
+        {
+            address_subscriptions_.erase(hash);
+            cache.unsubscribe(hash);
         }
     }
 
-    POST(complete_scripthash_subscribe, ec, std::move(status));
+    std::vector<hash_digest> statuses{};
+    if (!ec)
+    {
+        auto& index = server().scripthashes();
+        statuses.reserve(batch->hashes.size());
+        for (const auto& hash: batch->hashes)
+        {
+            const auto it = address_subscriptions_.find(hash);
+            statuses.push_back(it == address_subscriptions_.end() ?
+                null_hash : it->second.status);
+            index.subscribe(identifier(), hash);
+        }
+
+        // Index after stopping_ may orphan the key, so test after.
+        subscribed_address_.store(true, relaxed);
+        if (stopping_.load())
+            index.unsubscribe(identifier());
+    }
+
+    report_usage();
+    if (batch->many)
+        POST(complete_scripthash_subscribe_many, ec, std::move(statuses));
+    else
+        POST(complete_scripthash_subscribe, ec,
+            statuses.empty() ? null_hash : statuses.front());
 }
 
 void protocol_electrum::complete_scripthash_subscribe(const code& ec,
@@ -128,6 +300,84 @@ void protocol_electrum::complete_scripthash_subscribe(const code& ec,
         value_t{ encode_base16(status) }, 128);
 }
 
+// subscribe_many (server extension)
+// ----------------------------------------------------------------------------
+// Subscribes a set of scripthashes in one request, returning statuses in
+// request order. Initial statuses are computed concurrently.
+
+void protocol_electrum::handle_blockchain_scripthash_subscribe_many(
+    const code& ec, rpc_interface::blockchain_scripthash_subscribe_many,
+    const interface::array_t& scripthashes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped(ec))
+        return;
+
+    if (!at_least(electrum::version::v1_1))
+    {
+        send_code(error::wrong_version);
+        return;
+    }
+
+    if (scripthashes.empty())
+    {
+        send_code(error::invalid_argument);
+        return;
+    }
+
+    if (scripthashes.size() > options().maximum_subscriptions)
+    {
+        send_code(error::subscription_limit);
+        return;
+    }
+
+    const auto batch = std::make_shared<subscription_batch>();
+    batch->type = notify_t::scripthash;
+    batch->many = true;
+    batch->hashes.reserve(scripthashes.size());
+    for (const auto& item: scripthashes)
+    {
+        hash_digest hash{};
+        if (!std::holds_alternative<string_t>(item.value()) ||
+            !decode_hash(hash, std::get<string_t>(item.value())))
+        {
+            send_code(error::invalid_argument);
+            return;
+        }
+
+        batch->hashes.push_back(hash);
+    }
+
+    scripthash_subscribe(batch);
+}
+
+void protocol_electrum::complete_scripthash_subscribe_many(const code& ec,
+    const std::vector<hash_digest>& statuses) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    monitor(false);
+    if (stopped())
+        return;
+
+    if (ec)
+    {
+        send_code(ec);
+        return;
+    }
+
+    array_t out(statuses.size());
+    std::ranges::transform(statuses, out.begin(),
+        [](const auto& status) NOEXCEPT
+    {
+        return status == null_hash ? value_t{} :
+            value_t{ encode_base16(status) };
+    });
+
+    send_result(std::move(out), add1(statuses.size()) * 68);
+}
+
 // unsubscribe
 // ----------------------------------------------------------------------------
 
@@ -180,6 +430,13 @@ void protocol_electrum::do_scripthash_unsubscribe(
     if (is_zero(address_subscriptions_.size()))
         subscribed_address_.store(false, relaxed);
 
+    if (found)
+    {
+        server().scripthashes().unsubscribe(identifier(), hash);
+        server().statuses().unsubscribe(hash);
+    }
+
+    report_usage();
     POST(complete_scripthash_unsubscribe, found);
 }
 
@@ -191,31 +448,52 @@ void protocol_electrum::complete_scripthash_unsubscribe(bool found) NOEXCEPT
 // notify
 // ----------------------------------------------------------------------------
 
-// Notifier for blockchain_scripthash_subscribe events.
-void protocol_electrum::do_scripthash(node::header_t) NOEXCEPT
+// Notifier for blockchain_scripthash_subscribe events (organized block).
+// Only subscriptions touched by the block (by output or spent prevout) are
+// requeried, as intersected once per block by the server-wide index. Status
+// of unconfirmed descendants of block txs is updated by pool events.
+void protocol_electrum::do_scripthash(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
+    ++notifications_;
 
-    for (auto& [key, sub]: address_subscriptions_)
+    // Keys touched by reorganization are unknown, requery all.
+    if (rescan_)
     {
-        const auto previous = sub.status;
-        if (const auto ec = get_scripthash_history(sub, key, max_size_t))
-        {
-            if (ec == database::error::query_canceled)
-                return;
+        rescan_ = false;
+        do_scripthash_all(link);
+        return;
+    }
 
-            if (ec != error::not_found)
-            {
-                LOGF("Electrum::do_scripthash, " << ec.message());
-            }
-        }
-        else if (sub.status != previous)
-        {
-            POST(scripthash_notify, sub.status, key, sub.type);
-        }
+    scripthash_index::keys keys{};
+    if (const auto ec = server().scripthashes().touched(keys, archive(), link,
+        identifier()))
+    {
+        LOGF("Electrum::do_scripthash, " << ec.message());
+        do_scripthash_all(link);
+        return;
+    }
+
+    for (const auto& key: keys)
+    {
+        const auto it = address_subscriptions_.find(key);
+        if (it != address_subscriptions_.end() &&
+            !update_scripthash(it->second, it->first, link))
+            return;
     }
 }
 
+// Notifier for blockchain_scripthash_subscribe events (all subscriptions).
+void protocol_electrum::do_scripthash_all(node::header_t) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+    ++notifications_;
+
+    for (auto& [key, sub]: address_subscriptions_)
+        if (!update_scripthash(sub, key, {}))
+            return;
+}
+
 void protocol_electrum::scripthash_notify(const hash_digest& status,
     const hash_digest& hash, notify_t type) NOEXCEPT
 {
@@ -246,42 +524,41 @@ std::string protocol_electrum::to_method_name(notify_t type) NOEXCEPT
     }
 }
 
-// private/static
-void protocol_electrum::write_status(midstate& accumulator,
-    const history& history) NOEXCEPT
-{
-    // Height is zero (rooted) or max_size_t for unconfirmed history txs.
-    accumulator.write(encode_hash(history.tx.hash()));
-    accumulator.write(":");
-    accumulator.write(std::to_string(to_signed(history.tx.height())));
-    accumulator.write(":");
-}
-
 // protected
-code protocol_electrum::get_scripthash_history(address_subscription& sub,
-    const hash_digest& hash, size_t limit) NOEXCEPT
+// Update status and notify if changed, false if query canceled.
+bool protocol_electrum::update_scripthash(address_subscription& sub,
+    const hash_digest& hash, const database::header_link& link) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    histories history{};
-    const auto& query = archive();
-    if (const auto ec = query.get_history(stopping_, sub.cursor, history, hash,
-        limit, turbo_))
-        return ec;
-
-    if (history.empty())
-        return error::success;
+    const auto previous = sub.status;
+    if (const auto ec = get_scripthash_status(sub, hash, link))
+    {
+        if (ec == database::error::query_canceled)
+            return false;
 
-    auto it = history.cbegin();
-    while (it != history.cend() && it->confirmed())
-        write_status(sub.accumulator, *it++);
+        if (ec != error::not_found)
+        {
+            LOGF("Electrum::update_scripthash, " << ec.message());
+        }
+    }
+    else if (sub.status != previous)
+    {
+        POST(scripthash_notify, sub.status, hash, sub.type);
+    }
 
-    midstate copy = sub.accumulator;
-    while (it != history.cend())
-        write_status(copy, *it++);
+    return true;
+}
 
-    sub.status = copy.flush();
-    return error::success;
+// protected
+// Status is computed once per organized block across subscribed channels,
+// a terminal link (not a block notification) always updates the status.
+code protocol_electrum::get_scripthash_status(address_subscription& sub,
+    const hash_digest& hash, const database::header_link& link) NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+    return server().statuses().status(sub.status, archive(), stopping_, hash,
+        link, max_size_t, turbo_);
 }
 
 BC_POP_WARNING()
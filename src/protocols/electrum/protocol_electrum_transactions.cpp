@@ -21,6 +21,8 @@
 #include <ranges>
 #include <utility>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -101,50 +103,78 @@ void protocol_electrum::handle_blockchain_transaction_broadcast_package(
         return;
     }
 
-    const auto& txs_hex = std::get<array_t>(raw_txs.value());
-    if (txs_hex.empty())
+    const auto package = std::make_shared<tx_package>();
+    const auto& txs = std::get<array_t>(raw_txs.value());
+    if (const auto code = parse_package(package->txs, txs))
     {
-        send_code(error::invalid_argument);
+        send_code(code);
         return;
     }
 
-    size_t size{};
-    object_t result{ { "success", true }, { "errors", array_t{} } };
-    auto& success = std::get<bool>(result["success"].value());
-    auto& errors = std::get<array_t>(result["errors"].value());
+    // Transactions are validated concurrently, children against the
+    // outputs of their in-package parents (populated here).
+    const auto count = package->txs.size();
+    package->faults.resize(count);
+    package->remaining.store(count);
+    populate_package(package->txs);
 
-    for (const auto& tx_hex: txs_hex)
-    {
-        if (!std::holds_alternative<string_t>(tx_hex.value()))
-        {
-            send_code(error::invalid_argument);
-            return;
-        }
+    monitor(true);
+    for (size_t index{}; index < count; ++index)
+        PARALLEL(do_broadcast_package, package, index);
+}
+
+void protocol_electrum::do_broadcast_package(const tx_package::ptr& package,
+    size_t index) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+
+    // The package is relayed only once all are validated.
+    package->faults.at(index) = stopping_ ? network::error::channel_stopped :
+        validate_tx(*package->txs.at(index));
+
+    if (is_one(package->remaining.fetch_sub(one)))
+        POST(complete_broadcast_package, package);
+}
+
+void protocol_electrum::complete_broadcast_package(
+    const tx_package::ptr& package) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    monitor(false);
+    if (stopped())
+        return;
+
+    // A child is not accepted without its in-package parent.
+    reject_orphans(*package);
 
-        read::base16::copy hexer{ std::get<string_t>(tx_hex.value()) };
-        const auto tx = to_shared<chain::transaction>(hexer, true);
-        if (!tx->is_valid() || !hexer.is_exhausted())
+    size_t size{};
+    array_t errors{};
+    for (size_t index{}; index < package->txs.size(); ++index)
+    {
+        // Accepted transactions are relayed in topological order.
+        const auto& tx = package->txs.at(index);
+        const auto& fault = package->faults.at(index);
+        if (!fault)
         {
-            send_code(error::invalid_argument);
-            return;
+            relay_tx(tx);
+            continue;
         }
 
-        // TODO: this handles each transaction independently.
-        const auto fault = broadcast_tx(tx);
-        if (fault)
+        const auto message = fault.message();
+        size += message.size();
+        errors.push_back(object_t
         {
-            const auto message = fault.message();
-            size += message.size();
-            errors.push_back(object_t
-            {
-                { "txid", encode_hash(tx->hash(false)) },
-                { "error", message }
-            });
-        }
+            { "txid", encode_hash(tx->hash(false)) },
+            { "error", message }
+        });
     }
 
-    success = errors.empty();
-    send_result(result, 42 + size);
+    const auto success = errors.empty();
+    send_result(object_t
+    {
+        { "success", success },
+        { "errors", std::move(errors) }
+    }, 42 + size);
 }
 
 void protocol_electrum::handle_blockchain_transaction_get(const code& ec,
@@ -271,23 +301,22 @@ void protocol_electrum::handle_blockchain_transaction_get_merkle(
         return;
     }
 
-    auto hashes = query.get_tx_keys(block_link);
-    if (hashes.empty())
+    const auto levels = server().merkles().get(query, block_link);
+    if (!levels)
     {
         send_code(error::server_error);
         return;
     }
 
-    const auto index = find_position(hashes, hash);
+    const auto index = find_position(levels->front(), hash);
     if (is_negative(index))
     {
         send_code(error::not_found);
         return;
     }
 
-    using namespace chain;
     const auto position = to_unsigned(index);
-    const auto proof = block::merkle_branch(index, std::move(hashes));
+    const auto proof = merkle_branch(*levels, position);
 
     array_t branch(proof.size());
     std::ranges::transform(proof, branch.begin(),
@@ -346,21 +375,20 @@ void protocol_electrum::handle_blockchain_transaction_id_from_position(
         return;
     }
 
-    auto hashes = query.get_tx_keys(block_link);
-    if (hashes.empty())
+    const auto levels = server().merkles().get(query, block_link);
+    if (!levels)
     {
         send_code(error::server_error);
         return;
     }
 
-    if (position >= hashes.size())
+    if (position >= levels->front().size())
     {
         send_code(error::not_found);
         return;
     }
 
-    using namespace chain;
-    const auto proof = block::merkle_branch(position, std::move(hashes));
+    const auto proof = merkle_branch(*levels, position);
 
     array_t branch(proof.size());
     std::ranges::transform(proof, branch.begin(),
@@ -379,31 +407,31 @@ void protocol_electrum::handle_blockchain_transaction_id_from_position(
 code protocol_electrum::validate_tx(
     const chain::transaction& tx) const NOEXCEPT
 {
+    // The context of the next block, in which a pool tx would confirm.
     const auto& query = archive();
-    const auto& settings = system_settings();
-    const auto link = query.to_confirmed(query.get_top_confirmed());
-    const auto key = query.get_header_key(link);
-    const auto state = query.get_chain_state(settings, key);
-
-    // The store always has chain state for the confirmed top.
-    if (!state)
+    const auto next = server().states().get(query, system_settings());
+    if (!next)
         return database::error::integrity;
 
-    // The context of the next block, in which a pool tx would confirm.
-    const auto pool = chain::chain_state{ *state, settings }.context();
-    return node::validate_transaction(tx, query, pool);
+    return node::validate_transaction(tx, query, next->state->context());
 }
 
 code protocol_electrum::broadcast_tx(
     const chain::transaction::cptr& tx) NOEXCEPT
 {
-    const auto ec = validate_tx(*tx);
+    if (const auto ec = validate_tx(*tx))
         return ec;
 
-    BROADCAST(peer::transaction, to_shared<peer::transaction>(tx));
+    relay_tx(tx);
     return error::success;
 }
 
+void protocol_electrum::relay_tx(
+    const chain::transaction::cptr& tx) NOEXCEPT
+{
+    BROADCAST(peer::transaction, to_shared<peer::transaction>(tx));
+}
+
 BC_POP_WARNING()
 
 } // namespace server
@@ -18,10 +18,15 @@
  */
 #include <bitcoin/server/protocols/protocol_native.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <optional>
+#include <string>
 #include <utility>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -102,6 +107,10 @@ void protocol_native::stopping(const code& ec) NOEXCEPT
     stopping_.store(true);
     dispatcher_.stop(ec);
     unsubscribe_chase();
+
+    // Subscribers are stranded and test stopped, so none can be orphaned.
+    server().scripthashes().unsubscribe(identifier());
+    server().outpoints().unsubscribe(identifier());
     protocol_html::stopping(ec);
 }
 
@@ -141,6 +150,7 @@ bool protocol_native::try_dispatch_object(const http::request& request) NOEXCEPT
     if (media == media_type::text_html)
         return false;
 
+    set_conditions(request);
     if (const auto ec = dispatcher_.notify(model))
         send_internal_server_error(ec, request);
 
@@ -226,6 +236,18 @@ bool protocol_native::handle_chase(const code&, node::chase event_,
                 POST(do_block, std::get<node::header_t>(value), media);
             }
 
+            if (address_subscribe_.load(relaxed))
+            {
+                BC_ASSERT(std::holds_alternative<node::header_t>(value));
+                POST(do_address, std::get<node::header_t>(value));
+            }
+
+            if (output_subscribe_.load(relaxed))
+            {
+                BC_ASSERT(std::holds_alternative<node::header_t>(value));
+                POST(do_output, std::get<node::header_t>(value));
+            }
+
             break;
         }
         case node::chase::reorganized:
@@ -277,6 +299,193 @@ void protocol_native::inject(value& out, std::optional<uint32_t> height,
 
 BC_POP_WARNING()
 
+// Address and output watches are bounded cumulatively per channel.
+bool protocol_native::watches_full() const NOEXCEPT
+{
+    return ceilinged_add(address_watches_.size(), output_watches_.size()) >=
+        server_settings().native.maximum_subscriptions;
+}
+
+// Responses are keyed by block link, so by-hash and by-height requests share.
+std::string protocol_native::to_key(std::string_view method,
+    const database::header_link& link, bool witness,
+    uint8_t media) NOEXCEPT
+{
+    const auto params = std::to_string(link.value) + (witness ? "/w" : "");
+    return response_cache::key("native", method, params,
+        http::from_media_type(static_cast<media_type>(media)));
+}
+
+// The cache retains the response, which the response body references.
+// A binary (block) range is sent as a view of the response, uncompressed.
+// Compressed variants are cached alongside, keyed by response key and coding,
+// so that a hot response is compressed once.
+void protocol_native::send_cached(const response_cache::bytes_ptr& response,
+    const std::string& key, const database::header_link& link,
+    uint8_t media) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const auto type = static_cast<media_type>(media);
+    if (type == media_type::application_octet_stream)
+    {
+        byte_range range{};
+        switch (get_range(range, response->size()))
+        {
+            case range_request::partial:
+                send_partial(response, range, type);
+                return;
+            case range_request::unsatisfiable:
+                send_range_not_satisfiable(response->size());
+                return;
+            default:
+                break;
+        }
+    }
+
+    const auto coding = encoding(response->size());
+    if (coding == content_coding::identity)
+    {
+        send_shared(response, type, coding);
+        return;
+    }
+
+    const auto& query = archive();
+    auto& cache = server().responses();
+    const auto variant = key + "/" + std::string{ from_content_coding(coding) };
+    if (const auto encoded = cache.get(query, variant))
+    {
+        send_shared(encoded, type, coding);
+        return;
+    }
+
+    auto compressed = compress(*response, coding);
+    if (compressed.empty())
+    {
+        send_shared(response, type, content_coding::identity);
+        return;
+    }
+
+    send_shared(cache.put(query, variant, link, std::move(compressed)), type,
+        coding);
+}
+
+// Append the intersection of the range and the bytes at the offset.
+static void append_range(std::string& out, const data_slice& bytes,
+    size_t& offset, const byte_range& range) NOEXCEPT
+{
+    const auto end = ceilinged_add(offset, bytes.size());
+    const auto first = std::max(offset, range.first);
+    const auto last = std::min(end, add1(range.last));
+    if (first < last)
+        out.append(std::next(pointer_cast<const char>(bytes.data()),
+            first - offset), last - first);
+
+    offset = end;
+}
+
+// Only the block parts that intersect the range are read, by walking the
+// header and transaction sizes, so a range does not serialize the block.
+bool protocol_native::get_block_range(std::string& out,
+    const database::header_link& link, const byte_range& range,
+    bool witness) const NOEXCEPT
+{
+    const auto& query = archive();
+    const auto count = query.get_tx_count(link);
+    out.clear();
+    out.reserve(range.length());
+
+    data_chunk prefix(chain::header::serialized_size() + variable_size(count));
+    stream::out::fast sink{ prefix };
+    write::bytes::fast writer{ sink };
+    if (!query.get_wire_header(writer, link))
+        return false;
+
+    writer.write_variable(count);
+    size_t offset{};
+    append_range(out, prefix, offset, range);
+
+    for (size_t position{}; position < count && offset <= range.last;
+        ++position)
+    {
+        size_t nominal{}, maximal{};
+        const auto tx = query.get_position_tx(link, position);
+        if (!query.get_tx_sizes(nominal, maximal, tx))
+            return false;
+
+        // Transactions that precede the range are skipped by size.
+        const auto size = witness ? maximal : nominal;
+        if (ceilinged_add(offset, size) <= range.first)
+        {
+            offset += size;
+            continue;
+        }
+
+        const auto wire = query.get_wire_tx(tx, witness);
+        if (wire.size() != size)
+            return false;
+
+        append_range(out, wire, offset, range);
+    }
+
+    return out.size() == range.length();
+}
+
+// Conditional requests (http only).
+// ----------------------------------------------------------------------------
+
+// A presented tag of a named object is matched before any store access.
+// A wildcard is not matched here, as the object may not exist.
+bool protocol_native::revalidate(std::string_view method,
+    const hash_digest& hash, std::string_view params, uint8_t media) NOEXCEPT
+{
+    if (websocket())
+        return false;
+
+    const auto tag = entity_tag("native", method, hash, params,
+        static_cast<media_type>(media));
+    if (!is_not_modified(tag))
+        return false;
+
+    send_not_modified(tag);
+    return true;
+}
+
+bool protocol_native::revalidate(std::string_view method,
+    const std::optional<hash_cptr>& hash, std::string_view params,
+    uint8_t media) NOEXCEPT
+{
+    return hash.has_value() && revalidate(method, *hash.value(), params, media);
+}
+
+// An object of a deep-confirmed block is tagged, or not modified if matched.
+bool protocol_native::validate(std::string_view method,
+    const hash_digest& hash, const database::header_link& block,
+    std::string_view params, uint8_t media) NOEXCEPT
+{
+    if (websocket() || !is_immutable(block))
+        return false;
+
+    // The resource is now known to exist, so a wildcard also matches.
+    const auto tag = entity_tag("native", method, hash, params,
+        static_cast<media_type>(media));
+    if (is_not_modified(tag, true))
+    {
+        send_not_modified(tag);
+        return true;
+    }
+
+    set_immutable(tag);
+    return false;
+}
+
+bool protocol_native::validate(std::string_view method,
+    const database::header_link& link, std::string_view params,
+    uint8_t media) NOEXCEPT
+{
+    return !websocket() && validate(method, archive().get_header_key(link),
+        link, params, media);
+}
+
 database::header_link protocol_native::to_header(
     const std::optional<uint32_t>& height,
     const std::optional<hash_cptr>& hash) NOEXCEPT
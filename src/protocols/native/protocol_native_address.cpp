@@ -19,8 +19,12 @@
 #include <bitcoin/server/protocols/protocol_native.hpp>
 
 #include <atomic>
+#include <memory>
+#include <string>
 #include <utility>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -28,6 +32,7 @@ namespace server {
 #define CLASS protocol_native
 
 using namespace system;
+constexpr auto relaxed = std::memory_order_relaxed;
 
 BC_PUSH_WARNING(NO_INCOMPLETE_SWITCH)
 
@@ -64,12 +69,46 @@ void protocol_native::do_get_address(uint8_t media, bool turbo,
     database::outpoints set{};
     const auto& query = archive();
     const auto ec = query.get_address_outpoints(stopping_, set, *hash, turbo);
-    POST(complete_get_address, ec, media, std::move(set));
+    POST(complete_get_address, ec, media, to_outpoints(media, set));
+}
+
+// private/static
+// The set is serialized in the parallel task, so that only the body is posted
+// to the strand and the set is released before the response is sent.
+std::shared_ptr<const std::string> protocol_native::to_outpoints(
+    uint8_t media, const database::outpoints& set) NOEXCEPT
+{
+    if (set.empty())
+        return {};
+
+    const auto size = set.size() * chain::outpoint::serialized_size();
+    switch (media)
+    {
+        case data:
+        {
+            const auto out = std::make_shared<std::string>(size, '\0');
+            stream::out::fast sink{ *out };
+            write::bytes::fast writer{ sink };
+            for (const auto& outpoint: set)
+                outpoint.to_data(writer);
+
+            BC_ASSERT(writer);
+            return out;
+        }
+        case text:
+            return std::make_shared<const std::string>(
+                to_hex_array(set, size));
+        case json:
+            return std::make_shared<const std::string>(
+                boost::json::serialize(value_from(set)));
+    }
+
+    return {};
 }
 
 // This is shared by the three get_address... methods.
 void protocol_native::complete_get_address(const code& ec, uint8_t media,
-    const database::outpoints& set) NOEXCEPT
+    const std::shared_ptr<const std::string>& body) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
@@ -85,27 +124,14 @@ void protocol_native::complete_get_address(const code& ec, uint8_t media,
         return;
     }
 
-    if (set.empty())
+    // Empty set or unsupported media.
+    if (!body)
     {
         send_not_found();
         return;
     }
 
-    const auto size = set.size() * chain::outpoint::serialized_size();
-    switch (media)
-    {
-        case data:
-            send_chunk(to_bin_array(set, size));
-            return;
-        case text:
-            send_text(to_hex_array(set, size));
-            return;
-        case json:
-            send_json(value_from(set), two * size);
-            return;
-    }
-
-    send_not_found();
+    send_shared(body, static_cast<media_type>(media));
 }
 
 // handle_get_address_confirmed
@@ -143,7 +169,7 @@ void protocol_native::do_get_address_confirmed(uint8_t media, bool turbo,
     const auto& query = archive();
     auto ec = query.get_confirmed_unspent_outpoints(stopping_, set, *hash,
         turbo);
-    POST(complete_get_address, ec, media, std::move(set));
+    POST(complete_get_address, ec, media, to_outpoints(media, set));
 }
 
 // handle_get_address_unconfirmed
@@ -234,24 +260,108 @@ void protocol_native::complete_get_address_balance(const code& ec,
     send_not_found();
 }
 
+// handle_get_address_subscribe
+// ----------------------------------------------------------------------------
+
 bool protocol_native::handle_get_address_subscribe(const code& ec,
     interface::address_subscribe, uint8_t version, uint8_t media,
     const system::hash_cptr& hash, bool turbo, bool stop) NOEXCEPT
 {
+    BC_ASSERT(stranded());
+
     if (stopped(ec))
         return false;
 
-    // TODO: map.
-    address_subscribe_.store(!stop, std::memory_order_relaxed);
     if (stop)
     {
+        if (to_bool(address_watches_.erase(*hash)))
+            server().scripthashes().unsubscribe(identifier(), *hash);
+
+        address_subscribe_.store(!address_watches_.empty(), relaxed);
         send_empty();
         return true;
     }
 
+    if (!archive().address_enabled())
+    {
+        send_not_implemented();
+        return true;
+    }
+
+    // Resubscription replaces the notification media.
+    const auto it = address_watches_.find(*hash);
+    if (it != address_watches_.end())
+    {
+        it->second = static_cast<media_type>(media);
+    }
+    else if (watches_full())
+    {
+        send_too_many_requests(error::subscription_limit);
+        return true;
+    }
+    else
+    {
+        address_watches_.try_emplace(*hash, static_cast<media_type>(media));
+        server().scripthashes().subscribe(identifier(), *hash);
+        address_subscribe_.store(true, relaxed);
+    }
+
+    // Response is the current address outpoints, as with get_address.
     return handle_get_address(ec, {}, version, media, hash, turbo);
 }
 
+// notify
+// The scripthashes touched by the block (its output and spent prevout
+// scripts) are intersected with all channel watches once per block. Each
+// watched scripthash is notified with the outpoints of it that the block
+// changes (created and spent), serialized as for get_address and preceded by
+// the scripthash (json: { "address", "outpoints" }).
+void protocol_native::do_address(node::header_t link) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    scripthash_index::keys keys{};
+    const auto& query = archive();
+    if (server().scripthashes().touched(keys, query, link, identifier()))
+        return;
+
+    chain::block::cptr block{};
+    for (const auto& key: keys)
+    {
+        const auto it = address_watches_.find(key);
+        if (it == address_watches_.end())
+            continue;
+
+        // The block is read only if a watched scripthash is touched.
+        if (!block)
+        {
+            block = query.get_block(link, false);
+            if (!block || !query.populate_without_metadata(*block))
+                return;
+        }
+
+        database::outpoints set{};
+        touched_address(set, *block, key);
+        const auto size = set.size() * chain::outpoint::serialized_size();
+        switch (to_value(it->second))
+        {
+            case data:
+                notify_chunk(splice(to_chunk(key), to_bin_array(set, size)));
+                break;
+            case text:
+                notify_text(encode_hash(key) + to_hex_array(set, size));
+                break;
+            case json:
+                notify_json(boost::json::object
+                {
+                    { "address", encode_hash(key) },
+                    { "outpoints", value_from(set) }
+                }, two * (hash_size + size));
+                break;
+        }
+    }
+}
+
 BC_POP_WARNING()
 
 } // namespace server
@@ -22,8 +22,10 @@
 #include <iterator>
 #include <optional>
 #include <ranges>
+#include <string>
 #include <utility>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -103,6 +105,10 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
     if (stopped(ec))
         return false;
 
+    const auto params = witness ? "w" : "";
+    if (revalidate("block", hash, params, media))
+        return true;
+
     const auto& query = archive();
     const auto link = to_header(height, hash);
     if (link.is_terminal())
@@ -111,6 +117,17 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
         return true;
     }
 
+    if (validate("block", link, params, media))
+        return true;
+
+    auto& cache = server().responses();
+    const auto key = to_key("block", link, witness, media);
+    if (const auto response = cache.get(query, key))
+    {
+        send_cached(response, key, link, media);
+        return true;
+    }
+
     size_t size{};
     if (!query.get_block_size(size, link, witness))
     {
@@ -118,11 +135,39 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
         return true;
     }
 
+    // A miss is written from the store into the one buffer that is cached and
+    // sent. The channel writes each response as a single complete message, so
+    // incremental (buffer_body) transfer requires a serializing channel write.
     switch (media)
     {
         case data:
         {
-            data_chunk out(size);
+            // A range of an uncached block is read alone (and not cached).
+            byte_range range{};
+            switch (get_range(range, size))
+            {
+                case range_request::partial:
+                {
+                    std::string part{};
+                    if (!get_block_range(part, link, range, witness))
+                    {
+                        send_internal_server_error(
+                            database::error::integrity);
+                        return true;
+                    }
+
+                    send_partial(std::move(part), range,
+                        media_type::application_octet_stream);
+                    return true;
+                }
+                case range_request::unsatisfiable:
+                    send_range_not_satisfiable(size);
+                    return true;
+                default:
+                    break;
+            }
+
+            std::string out(size, '\0');
             stream::out::fast sink{ out };
             write::bytes::fast writer{ sink };
             if (!query.get_wire_block(writer, link, witness))
@@ -131,7 +176,8 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
                 return true;
             }
 
-            send_chunk(std::move(out));
+            send_cached(cache.put(query, key, link, std::move(out)), key,
+                link, media);
             return true;
         }
         case text:
@@ -145,7 +191,8 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
                 return true;
             }
 
-            send_text(std::move(out));
+            send_cached(cache.put(query, key, link, std::move(out)), key,
+                link, media);
             return true;
         }
         case json:
@@ -159,7 +206,8 @@ bool protocol_native::handle_get_block(const code& ec, interface::block,
 
             auto model = value_from(block);
             inject(model.at("header"), height, link);
-            send_json(std::move(model), two * size);
+            send_cached(cache.put(query, key, link,
+                boost::json::serialize(model)), key, link, media);
             return true;
         }
     }
@@ -175,8 +223,30 @@ bool protocol_native::handle_get_block_header(const code& ec,
     if (stopped(ec))
         return false;
 
+    if (revalidate("header", hash, {}, media))
+        return true;
+
+    const auto& query = archive();
     const auto link = to_header(height, hash);
-    if (const auto header = archive().get_header(link))
+    if (link.is_terminal())
+    {
+        send_not_found();
+        return true;
+    }
+
+    if (validate("header", link, {}, media))
+        return true;
+
+    auto& cache = server().responses();
+    const auto key = to_key("header", link, false, media);
+    if (const auto response = cache.get(query, key))
+    {
+        send_cached(response, key, link, media);
+        return true;
+    }
+
+    // A raw header is a single read, so only the json model is cached.
+    if (const auto header = query.get_header(link))
     {
         constexpr auto size = chain::header::serialized_size();
         switch (media)
@@ -190,7 +260,8 @@ bool protocol_native::handle_get_block_header(const code& ec,
             case json:
                 auto model = value_from(header);
                 inject(model, height, link);
-                send_json(std::move(model), two * size);
+                send_cached(cache.put(query, key, link,
+                    boost::json::serialize(model)), key, link, media);
                 return true;
         }
     }
@@ -354,9 +425,15 @@ bool protocol_native::handle_get_block_txs(const code& ec,
     if (stopped(ec))
         return false;
 
+    if (revalidate("block_txs", hash, {}, media))
+        return true;
+
     const auto& query = archive();
-    if (const auto hashes = query.get_tx_keys(to_header(height, hash));
-        !hashes.empty())
+    const auto link = to_header(height, hash);
+    if (validate("block_txs", link, {}, media))
+        return true;
+
+    if (const auto hashes = query.get_tx_keys(link); !hashes.empty())
     {
         const auto size = hashes.size() * hash_size;
         switch (media)
@@ -402,8 +479,16 @@ bool protocol_native::handle_get_block_filter(const code& ec,
         return true;
     }
 
+    const auto params = std::to_string(type);
+    if (revalidate("block_filter", hash, params, media))
+        return true;
+
+    const auto link = to_header(height, hash);
+    if (validate("block_filter", link, params, media))
+        return true;
+
     data_chunk filter{};
-    if (query.get_filter_body(filter, to_header(height, hash)))
+    if (query.get_filter_body(filter, link))
     {
         switch (media)
         {
@@ -438,8 +523,16 @@ bool protocol_native::handle_get_block_filter_hash(const code& ec,
         return true;
     }
 
+    const auto params = std::to_string(type);
+    if (revalidate("block_filter_hash", hash, params, media))
+        return true;
+
+    const auto link = to_header(height, hash);
+    if (validate("block_filter_hash", link, params, media))
+        return true;
+
     hash_digest filter_hash{ hash_size };
-    if (query.get_filter_hash(filter_hash, to_header(height, hash)))
+    if (query.get_filter_hash(filter_hash, link))
     {
         switch (media)
         {
@@ -474,8 +567,16 @@ bool protocol_native::handle_get_block_filter_header(const code& ec,
         return true;
     }
 
+    const auto params = std::to_string(type);
+    if (revalidate("block_filter_header", hash, params, media))
+        return true;
+
+    const auto link = to_header(height, hash);
+    if (validate("block_filter_header", link, params, media))
+        return true;
+
     hash_digest filter_head{ hash_size };
-    if (query.get_filter_head(filter_head, to_header(height, hash)))
+    if (query.get_filter_head(filter_head, link))
     {
         switch (media)
         {
@@ -503,9 +604,17 @@ bool protocol_native::handle_get_block_tx(const code& ec, interface::block_tx,
     if (stopped(ec))
         return false;
 
+    const auto params = std::to_string(position) + (witness ? "/w" : "");
+    if (revalidate("block_tx", hash, params, media))
+        return true;
+
     const auto& query = archive();
-    if (const auto tx = query.get_transaction(query.to_transaction(
-        to_header(height, hash), position), witness))
+    const auto link = to_header(height, hash);
+    if (validate("block_tx", link, params, media))
+        return true;
+
+    if (const auto tx = query.get_transaction(query.to_transaction(link,
+        position), witness))
     {
         const auto size = tx->serialized_size(witness);
         switch (media)
@@ -19,12 +19,15 @@
 #include <bitcoin/server/protocols/protocol_native.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/server_node.hpp>
 
 namespace libbitcoin {
 namespace server {
 
 using namespace system;
+constexpr auto relaxed = std::memory_order_relaxed;
 
 BC_PUSH_WARNING(NO_INCOMPLETE_SWITCH)
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
@@ -201,20 +204,84 @@ bool protocol_native::handle_get_output_subscribe(const code& ec,
     interface::output_subscribe, uint8_t version, uint8_t media,
     const system::hash_cptr& hash, uint32_t index, bool stop) NOEXCEPT
 {
+    BC_ASSERT(stranded());
+
     if (stopped(ec))
         return false;
 
-    // TODO: map.
-    output_subscribe_.store(stop, std::memory_order_relaxed);
+    const chain::point key{ *hash, index };
     if (stop)
     {
+        if (to_bool(output_watches_.erase(key)))
+            server().outpoints().unsubscribe(identifier(), key);
+
+        output_subscribe_.store(!output_watches_.empty(), relaxed);
         send_empty();
         return true;
     }
 
+    // Resubscription replaces the notification media.
+    const auto it = output_watches_.find(key);
+    if (it != output_watches_.end())
+    {
+        it->second = static_cast<media_type>(media);
+    }
+    else if (watches_full())
+    {
+        send_too_many_requests(error::subscription_limit);
+        return true;
+    }
+    else
+    {
+        output_watches_.try_emplace(key, static_cast<media_type>(media));
+        server().outpoints().subscribe(identifier(), key);
+        output_subscribe_.store(true, relaxed);
+    }
+
+    // Response is the current output, as with get_output.
     return handle_get_output(ec, {}, version, media, hash, index);
 }
 
+// notify
+// The outpoints touched by the block (its created outputs and spent prevouts)
+// are intersected with all channel watches once per block. The confirmed
+// spender of each watched outpoint is notified (creation is not notified).
+void protocol_native::do_output(node::header_t link) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    outpoint_index::keys keys{};
+    if (server().outpoints().touched(keys, archive(), link, identifier()))
+        return;
+
+    const auto& query = archive();
+    constexpr auto size = chain::point::serialized_size();
+    for (const auto& key: keys)
+    {
+        const auto it = output_watches_.find(key);
+        if (it == output_watches_.end())
+            continue;
+
+        const auto spender = query.get_spender(
+            query.find_confirmed_spender(key));
+        if (spender.is_null())
+            continue;
+
+        switch (to_value(it->second))
+        {
+            case data:
+                notify_chunk(to_bin(spender, size));
+                break;
+            case text:
+                notify_text(to_hex(spender, size));
+                break;
+            case json:
+                notify_json(value_from(spender), two * size);
+                break;
+        }
+    }
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -39,8 +39,17 @@ bool protocol_native::handle_get_tx(const code& ec, interface::tx, uint8_t,
     if (stopped(ec))
         return false;
 
+    const auto params = witness ? "w" : "";
+    if (revalidate("tx", *hash, params, media))
+        return true;
+
     const auto& query = archive();
-    if (const auto tx = query.get_transaction(query.to_tx(*hash), witness))
+    const auto link = query.to_tx(*hash);
+    if (!websocket() && validate("tx", *hash,
+        query.find_confirmed_block(*hash), params, media))
+        return true;
+
+    if (const auto tx = query.get_transaction(link, witness))
     {
         const auto size = tx->serialized_size(witness);
         switch (media)
@@ -18,6 +18,11 @@
  */
 #include <bitcoin/server/protocols/protocol_html.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
 #include <bitcoin/server/define.hpp>
 
 namespace libbitcoin {
@@ -166,7 +171,21 @@ void protocol_html::dispatch_file(const request& request) NOEXCEPT
     }
 
     constexpr auto octet_stream = media_type::application_octet_stream;
-    send_file(std::move(file), file_media_type(path, octet_stream), request);
+    const auto type = file_media_type(path, octet_stream);
+
+    byte_range range{};
+    set_conditions(request);
+    switch (get_range(range, file.size()))
+    {
+        case range_request::partial:
+            send_file(std::move(file), type, range, request);
+            return;
+        case range_request::unsatisfiable:
+            send_range_not_satisfiable(file.size(), request);
+            return;
+        default:
+            send_file(std::move(file), type, request);
+    }
 }
 
 // Senders.
@@ -176,13 +195,22 @@ constexpr auto data = media_type::application_octet_stream;
 constexpr auto json = media_type::application_json;
 constexpr auto text = media_type::text_plain;
 
+// Serialized for compression only if the size hint warrants it.
 void protocol_html::send_json(boost::json::value&& model, size_t size_hint,
     const request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
+    if (encoding(size_hint) != content_coding::identity)
+    {
+        send_string(boost::json::serialize(model), json, request);
+        return;
+    }
+
     response response{ status::ok, request.version() };
     add_common_headers(response, request);
     add_access_control_headers(response, request);
+    add_encoding_headers(response, content_coding::identity);
+    add_validator_headers(response);
     response.set(field::content_type, from_media_type(json));
     response.body() = json_value
     {
@@ -197,24 +225,49 @@ void protocol_html::send_text(std::string&& hexidecimal,
     const request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
+    send_string(std::move(hexidecimal), text, request);
+}
+
+void protocol_html::send_chunk(system::data_chunk&& bytes,
+    const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    std::string encoded{};
+    const auto coding = encode(encoded,
+        { pointer_cast<const char>(bytes.data()), bytes.size() });
+
     response response{ status::ok, request.version() };
     add_common_headers(response, request);
     add_access_control_headers(response, request);
-    response.set(field::content_type, from_media_type(text));
-    response.body() = std::move(hexidecimal);
+    add_encoding_headers(response, coding);
+    add_validator_headers(response);
+    response.set(field::content_type, from_media_type(data));
+    if (coding == content_coding::identity)
+        response.body() = std::move(bytes);
+    else
+        response.body() = std::move(encoded);
     response.prepare_payload();
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
-void protocol_html::send_chunk(system::data_chunk&& bytes,
+// The body is serialized by the caller in the given media type.
+void protocol_html::send_string(std::string&& serialized, media_type type,
     const request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
+    std::string encoded{};
+    const auto coding = encode(encoded, serialized);
+
     response response{ status::ok, request.version() };
     add_common_headers(response, request);
     add_access_control_headers(response, request);
-    response.set(field::content_type, from_media_type(data));
-    response.body() = std::move(bytes);
+    add_encoding_headers(response, coding);
+    add_validator_headers(response);
+    response.set(field::content_type, from_media_type(type));
+    if (coding == content_coding::identity)
+        response.body() = std::move(serialized);
+    else
+        response.body() = std::move(encoded);
     response.prepare_payload();
     SEND(std::move(response), handle_complete, _1, error::success);
 }
@@ -227,6 +280,7 @@ void protocol_html::send_file(file&& file, media_type type,
     response response{ status::ok, request.version() };
     add_common_headers(response, request);
     add_access_control_headers(response, request);
+    response.set(field::accept_ranges, "bytes");
     response.set(field::content_type, from_media_type(type));
     response.body() = std::move(file);
     response.prepare_payload();
@@ -259,6 +313,155 @@ void protocol_html::send_buffer(buffer_body::value_type&& buffer,
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
+// Shared bytes are compressed per response, see overload for cached variants.
+void protocol_html::send_shared(const std::shared_ptr<const std::string>& bytes,
+    media_type type, const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    BC_ASSERT_MSG(bytes, "sending null shared bytes");
+    std::string encoded{};
+    if (const auto coding = encode(encoded, *bytes);
+        coding != content_coding::identity)
+    {
+        send_shared(std::make_shared<const std::string>(std::move(encoded)),
+            type, coding, request);
+        return;
+    }
+
+    send_shared(bytes, type, content_coding::identity, request);
+}
+
+// The body references the shared bytes, which are retained by the handler.
+void protocol_html::send_shared(const std::shared_ptr<const std::string>& bytes,
+    media_type type, content_coding coding, const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    BC_ASSERT_MSG(bytes, "sending null shared bytes");
+    response response{ status::ok, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    add_encoding_headers(response, coding);
+    add_validator_headers(response);
+    response.set(field::content_type, from_media_type(type));
+    response.body() = span_body::value_type
+    {
+        pointer_cast<uint8_t>(const_cast<char*>(bytes->data())),
+        bytes->size()
+    };
+    response.prepare_payload();
+    SEND(std::move(response), handle_shared_complete, _1, bytes);
+}
+
+void protocol_html::handle_shared_complete(const code& ec,
+    const std::shared_ptr<const std::string>&) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    handle_complete(ec, error::success);
+}
+
+// The body references the range of the shared bytes (the full representation).
+void protocol_html::send_partial(const std::shared_ptr<const std::string>& bytes,
+    const byte_range& range, media_type type, const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    BC_ASSERT_MSG(bytes && range.last < bytes->size(), "invalid range");
+    response response{ status::partial_content, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    add_validator_headers(response);
+    response.set(field::accept_ranges, "bytes");
+    response.set(field::content_range, to_content_range(range));
+    response.set(field::content_type, from_media_type(type));
+    response.body() = span_body::value_type
+    {
+        pointer_cast<uint8_t>(std::next(const_cast<char*>(bytes->data()),
+            range.first)),
+        range.length()
+    };
+    response.prepare_payload();
+    SEND(std::move(response), handle_shared_complete, _1, bytes);
+}
+
+// The body is the content of the range alone (not the full representation).
+void protocol_html::send_partial(std::string&& part, const byte_range& range,
+    media_type type, const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    BC_ASSERT_MSG(part.size() == range.length(), "invalid range");
+    response response{ status::partial_content, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    add_validator_headers(response);
+    response.set(field::accept_ranges, "bytes");
+    response.set(field::content_range, to_content_range(range));
+    response.set(field::content_type, from_media_type(type));
+    response.body() = std::move(part);
+    response.prepare_payload();
+    SEND(std::move(response), handle_complete, _1, error::success);
+}
+
+// The range is truncated to maximum_file_range, which the client observes in
+// Content-Range (and requests any remainder).
+void protocol_html::send_file(file&& file, media_type type, byte_range range,
+    const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    BC_ASSERT_MSG(file.is_open(), "sending closed file handle");
+    range.last = std::min(range.last,
+        sub1(ceilinged_add(range.first, maximum_file_range)));
+
+    monitor(true);
+    PARALLEL(do_read_range, std::make_shared<network::http::file>(
+        std::move(file)), type, range, request);
+}
+
+// private
+void protocol_html::do_read_range(const file_ptr& file, media_type type,
+    const byte_range& range, const request& request) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+
+    boost::beast::error_code ec{};
+    const auto part = std::make_shared<std::string>(range.length(), '\0');
+    auto& handle = file->file();
+    handle.seek(range.first, ec);
+
+    size_t offset{};
+    while (!ec && offset < part->size())
+    {
+        const auto count = handle.read(std::next(part->data(), offset),
+            part->size() - offset, ec);
+
+        if (is_zero(count))
+            break;
+
+        offset += count;
+    }
+
+    const code result{ ec || offset != part->size() ? error::server_error :
+        error::success };
+    POST(complete_read_range, result, part, type, range, request);
+}
+
+// private
+void protocol_html::complete_read_range(const code& ec,
+    const std::shared_ptr<std::string>& part, media_type type,
+    const byte_range& range, const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    monitor(false);
+    if (stopped())
+        return;
+
+    if (ec)
+    {
+        send_internal_server_error(ec, request);
+        return;
+    }
+
+    send_partial(std::move(*part), range, type, request);
+}
+
 void protocol_html::send_empty(const request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
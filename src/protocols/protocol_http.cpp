@@ -18,7 +18,10 @@
  */
 #include <bitcoin/server/protocols/protocol_http.hpp>
 
+#include <string>
+#include <string_view>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -79,6 +82,149 @@ request_cptr protocol_http::reset_request() NOEXCEPT
     return system::to_shared<request>();
 }
 
+// Conditional requests.
+// ----------------------------------------------------------------------------
+// Only deep-confirmed objects are tagged, so a presented tag implies that its
+// object is immutable, allowing revalidation before any store access.
+
+void protocol_http::set_conditions(const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if_none_match_ = request[field::if_none_match];
+    encoding_ = negotiate_coding(request[field::accept_encoding]);
+    range_ = request[field::range];
+    if_range_ = request[field::if_range];
+    entity_tag_.clear();
+}
+
+bool protocol_http::is_not_modified(const std::string& tag,
+    bool exists) const NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (if_none_match_.empty())
+        return false;
+
+    return entity_match(if_none_match_, tag) ||
+        (exists && entity_wildcard(if_none_match_));
+}
+
+bool protocol_http::is_immutable(
+    const database::header_link& link) const NOEXCEPT
+{
+    const auto& query = archive();
+    size_t height{};
+    return query.get_height(height, link) &&
+        query.to_confirmed(height) == link &&
+        query.get_top_confirmed() >=
+            system::ceilinged_add(height, immutable_depth);
+}
+
+void protocol_http::set_immutable(const std::string& tag) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    entity_tag_ = tag;
+}
+
+void protocol_http::add_validator_headers(response& response) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (entity_tag_.empty())
+        return;
+
+    // A compressed body is a distinct representation, so its tag is weak.
+    if (response[field::content_encoding].empty())
+        response.set(field::etag, entity_tag_);
+    else
+        response.set(field::etag, "W/" + entity_tag_);
+
+    response.set(field::cache_control, "public, max-age=31536000, immutable");
+    entity_tag_.clear();
+}
+
+void protocol_http::send_not_modified(const std::string& tag,
+    const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    response response{ status::not_modified, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    set_immutable(tag);
+    add_validator_headers(response);
+    response.body() = empty_value{};
+    response.prepare_payload();
+    SEND(std::move(response), handle_complete, _1, error::success);
+}
+
+range_request protocol_http::get_range(byte_range& out,
+    size_t size) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (websocket() || range_.empty())
+        return range_request::full;
+
+    // Only entity tags are issued (not dates), and If-Range compares strongly.
+    if (!if_range_.empty() && (entity_tag_.empty() || if_range_ != entity_tag_))
+        return range_request::full;
+
+    return parse_range(out, range_, size);
+}
+
+void protocol_http::send_range_not_satisfiable(size_t size,
+    const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    response response{ status::range_not_satisfiable, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    response.set(field::content_range, to_content_range(size));
+    response.body() = empty_value{};
+    response.prepare_payload();
+    SEND(std::move(response), handle_complete, _1, error::success);
+}
+
+void protocol_http::send_too_many_requests(const code& reason,
+    const request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    response response{ status::too_many_requests, request.version() };
+    add_common_headers(response, request);
+    add_access_control_headers(response, request);
+    response.set(field::content_type, from_media_type(media_type::text_plain));
+    response.body() = reason.message();
+    response.prepare_payload();
+    SEND(std::move(response), handle_complete, _1, error::success);
+}
+
+// Content negotiation.
+// ----------------------------------------------------------------------------
+
+content_coding protocol_http::encoding(size_t size) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    return websocket() || size < minimum_compression ?
+        content_coding::identity : encoding_;
+}
+
+content_coding protocol_http::encode(std::string& out,
+    std::string_view body) NOEXCEPT
+{
+    const auto coding = encoding(body.size());
+    if (coding == content_coding::identity)
+        return coding;
+
+    out = compress(body, coding);
+    return out.empty() ? content_coding::identity : coding;
+}
+
+void protocol_http::add_encoding_headers(response& response,
+    content_coding coding) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    response.set(field::vary, "Accept-Encoding");
+    if (coding != content_coding::identity)
+        response.set(field::content_encoding, from_content_coding(coding));
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -19,6 +19,7 @@
 #include <bitcoin/server/server_node.hpp>
 
 #include <utility>
+#include <variant>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/sessions/sessions.hpp>
 
@@ -37,7 +38,8 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 server_node::server_node(query& query, const configuration& configuration,
     const logger& log) NOEXCEPT
   : full_node(query, configuration, log),
-    config_(configuration)
+    config_(configuration),
+    responses_(configuration.server.response_cache)
 {
 }
 
@@ -58,6 +60,64 @@ const settings& server_node::server_settings() const NOEXCEPT
     return config_.server;
 }
 
+// Services.
+// ----------------------------------------------------------------------------
+
+scripthash_index& server_node::scripthashes() NOEXCEPT
+{
+    return scripthashes_;
+}
+
+scripthash_status& server_node::statuses() NOEXCEPT
+{
+    return statuses_;
+}
+
+outpoint_index& server_node::outpoints() NOEXCEPT
+{
+    return outpoints_;
+}
+
+merkle_cache& server_node::merkles() NOEXCEPT
+{
+    return merkles_;
+}
+
+header_merkle& server_node::headers() NOEXCEPT
+{
+    return headers_;
+}
+
+rpc_calls& server_node::calls() NOEXCEPT
+{
+    return calls_;
+}
+
+response_cache& server_node::responses() NOEXCEPT
+{
+    return responses_;
+}
+
+fee_snapshot& server_node::fees() NOEXCEPT
+{
+    return fees_;
+}
+
+header_snapshot& server_node::notices() NOEXCEPT
+{
+    return notices_;
+}
+
+chain_snapshot& server_node::states() NOEXCEPT
+{
+    return states_;
+}
+
+subscription_usage& server_node::usage() NOEXCEPT
+{
+    return usage_;
+}
+
 // Sequences.
 // ----------------------------------------------------------------------------
 
@@ -71,10 +131,44 @@ void server_node::do_run(const result_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    // Subscribed before any channel, so popped blocks are evicted from shared
+    // services before any channel is notified of the reorganization.
+    subscribe_events(std::bind(&server_node::handle_event, this, _1, _2, _3));
+
     // Start services after node is running.
     full_node::do_run(std::bind(&server_node::start_admin, this, _1, handler));
 }
 
+// Release the shared state of popped blocks once per reorganization.
+bool server_node::handle_event(const code& ec, chase event_,
+    event_value value) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (ec)
+        return false;
+
+    if (event_ == chase::reorganized)
+    {
+        BC_ASSERT(std::holds_alternative<header_t>(value));
+        const auto height = archive().get_height(std::get<header_t>(value));
+        if (height.is_terminal())
+        {
+            // An unknown branch point rewinds every status to its initial state.
+            statuses_.reset();
+        }
+        else
+        {
+            merkles_.reorganized(height.value);
+            headers_.reorganized(height.value);
+            responses_.reorganized(height.value);
+            statuses_.reorganized(height.value);
+        }
+    }
+
+    return true;
+}
+
 void server_node::start_admin(const code& ec,
     const result_handler& handler) NOEXCEPT
 {
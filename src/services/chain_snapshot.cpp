@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/chain_snapshot.hpp>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+chain_snapshot::next_ptr chain_snapshot::get(const node::query& query,
+    const system::settings& settings) NOEXCEPT
+{
+    const auto link = query.to_confirmed(query.get_top_confirmed());
+    if (link.is_terminal())
+        return {};
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (next_ && next_->link == link.value)
+            return next_;
+    }
+
+    // Computed outside of the lock, a concurrent miss may compute it twice.
+    // The store always has chain state for the confirmed top.
+    const auto top = query.get_chain_state(settings,
+        query.get_header_key(link));
+    if (!top)
+        return {};
+
+    const auto out = std::make_shared<const next>(link.value,
+        std::make_shared<const chain::chain_state>(*top, settings));
+
+    std::unique_lock lock{ mutex_ };
+    next_ = out;
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/fee_snapshot.hpp>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+fee_snapshot::bins_ptr fee_snapshot::get(const node::query& query) NOEXCEPT
+{
+    const auto link = query.to_confirmed(query.get_top_confirmed());
+    if (link.is_terminal())
+        return {};
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (bins_ && link_ == link.value)
+            return bins_;
+    }
+
+    // Computed outside of the lock, a concurrent miss may compute it twice.
+    // Fee rates require prevout values, populated from the store.
+    const auto block = query.get_block(link, true);
+    if (!block || !query.populate_without_metadata(*block))
+        return {};
+
+    const auto bins = std::make_shared<const fee_bins>(fee_histogram(*block));
+
+    std::unique_lock lock{ mutex_ };
+    link_ = link.value;
+    bins_ = bins;
+    return bins;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
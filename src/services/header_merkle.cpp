@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/header_merkle.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// The merkle node hash of a pair (double sha256 of the concatenation).
+static hash_digest node_hash(const hash_digest& left,
+    const hash_digest& right) NOEXCEPT
+{
+    return sha256::double_hash(left, right);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+code header_merkle::get_root_and_proof(hash_digest& root, hashes& proof,
+    const node::query& query, size_t target, size_t waypoint) NOEXCEPT
+{
+    if (target > waypoint)
+        return error::target_overflow;
+
+    const auto count = add1(waypoint);
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (is_current(query, count))
+        {
+            prove(root, proof, target, count);
+            return error::success;
+        }
+    }
+
+    std::unique_lock lock{ mutex_ };
+    if (!synchronize(query, count))
+        return error::not_found;
+
+    prove(root, proof, target, count);
+    return error::success;
+}
+
+void header_merkle::reorganized(size_t branch_height) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    if (!levels_.empty() && levels_.front().size() > add1(branch_height))
+        truncate(add1(branch_height));
+}
+
+size_t header_merkle::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return levels_.empty() ? zero : levels_.front().size();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// A header hash commits to all of its ancestors, so only the last leaf of the
+// prefix is compared against the confirmed chain.
+bool header_merkle::is_current(const node::query& query,
+    size_t count) const NOEXCEPT
+{
+    if (levels_.empty() || levels_.front().size() < count)
+        return false;
+
+    const auto link = query.to_confirmed(sub1(count));
+    return !link.is_terminal() &&
+        query.get_header_key(link) == levels_.front().at(sub1(count));
+}
+
+// Truncate to the last leaf still confirmed, and append through count.
+bool header_merkle::synchronize(const node::query& query,
+    size_t count) NOEXCEPT
+{
+    const auto stored = levels_.empty() ? zero : levels_.front().size();
+    auto height = std::min(stored, count);
+    while (!is_zero(height))
+    {
+        const auto link = query.to_confirmed(sub1(height));
+        if (!link.is_terminal() &&
+            query.get_header_key(link) == levels_.front().at(sub1(height)))
+            break;
+
+        --height;
+    }
+
+    if (height < std::min(stored, count))
+        truncate(height);
+
+    auto leaf = levels_.empty() ? zero : levels_.front().size();
+    for (; leaf < count; ++leaf)
+    {
+        const auto link = query.to_confirmed(leaf);
+        if (link.is_terminal())
+            return false;
+
+        push(query.get_header_key(link));
+    }
+
+    return true;
+}
+
+// Hash each interior node as its pair completes (amortized one per leaf).
+void header_merkle::push(const hash_digest& leaf) NOEXCEPT
+{
+    if (levels_.empty())
+        levels_.emplace_back();
+
+    levels_.front().push_back(leaf);
+    for (size_t height{}; is_even(levels_.at(height).size()); ++height)
+    {
+        const auto& level = levels_.at(height);
+        const auto node = node_hash(level.at(level.size() - two),
+            level.back());
+
+        if (levels_.size() == add1(height))
+            levels_.emplace_back();
+
+        levels_.at(add1(height)).push_back(node);
+    }
+}
+
+void header_merkle::truncate(size_t count) NOEXCEPT
+{
+    for (size_t height{}; height < levels_.size(); ++height)
+        levels_.at(height).resize(count / power2(height));
+
+    while (!levels_.empty() && levels_.back().empty())
+        levels_.pop_back();
+}
+
+// The complete nodes of a prefix are cached, so only its right edge (one node
+// per level, odd ends paired with themselves) is hashed here.
+void header_merkle::prove(hash_digest& root, hashes& proof, size_t target,
+    size_t count) const NOEXCEPT
+{
+    hashes edge{ levels_.front().at(sub1(count)) };
+    for (auto width = count; width > one; width = ceilinged_divide(width, two))
+    {
+        const auto& level = levels_.at(sub1(edge.size()));
+        const auto left = to_half(sub1(width)) * two;
+        edge.push_back(left == sub1(width) ?
+            node_hash(edge.back(), edge.back()) :
+            node_hash(level.at(left), edge.back()));
+    }
+
+    root = edge.back();
+    proof.clear();
+    proof.reserve(sub1(edge.size()));
+
+    auto position = target;
+    for (size_t height{}, width = count; width > one; ++height)
+    {
+        // The last node of an odd level is paired with itself.
+        const auto sibling = is_even(position) ? add1(position) :
+            sub1(position);
+        const auto index = sibling < width ? sibling : position;
+        proof.push_back(index == sub1(width) ? edge.at(height) :
+            levels_.at(height).at(index));
+
+        position = to_half(position);
+        width = ceilinged_divide(width, two);
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
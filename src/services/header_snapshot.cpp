@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/header_snapshot.hpp>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+header_snapshot::notice_ptr header_snapshot::get(const node::query& query,
+    const node::header_t& link) NOEXCEPT
+{
+    {
+        std::shared_lock lock{ mutex_ };
+        if (notice_ && link_ == link)
+            return notice_;
+    }
+
+    // Computed outside of the lock, a concurrent miss may compute it twice.
+    const auto height = query.get_height(link);
+    if (height.is_terminal())
+        return {};
+
+    const auto out = std::make_shared<const notice>(height.value,
+        encode_base16(query.get_wire_header(link)));
+
+    std::unique_lock lock{ mutex_ };
+    link_ = link;
+    notice_ = out;
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
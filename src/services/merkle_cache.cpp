@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/merkle_cache.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+merkle_cache::merkle_cache(size_t blocks) NOEXCEPT
+  : blocks_(std::max(blocks, one))
+{
+}
+
+merkle_cache::levels_ptr merkle_cache::get(const node::query& query,
+    const database::header_link& link) NOEXCEPT
+{
+    if (link.is_terminal())
+        return {};
+
+    {
+        std::unique_lock lock{ mutex_ };
+        const auto it = index_.find(link.value);
+        if (it != index_.end())
+        {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->levels;
+        }
+    }
+
+    // Computed outside of the lock, a concurrent miss may compute it twice.
+    const auto height = query.get_height(link);
+    auto txids = query.get_tx_keys(link);
+    if (height.is_terminal() || txids.empty())
+        return {};
+
+    const auto levels = std::make_shared<const merkle_levels>(
+        to_merkle_levels(std::move(txids)));
+
+    std::unique_lock lock{ mutex_ };
+    if (index_.contains(link.value))
+        return levels;
+
+    entries_.push_front({ link.value, height.value, levels });
+    index_.emplace(link.value, entries_.begin());
+    if (entries_.size() > blocks_)
+    {
+        index_.erase(entries_.back().link);
+        entries_.pop_back();
+    }
+
+    return levels;
+}
+
+void merkle_cache::reorganized(size_t branch_height) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        if (it->height > branch_height)
+        {
+            index_.erase(it->link);
+            it = entries_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+size_t merkle_cache::size() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return entries_.size();
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
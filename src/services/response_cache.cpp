@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/response_cache.hpp>
+
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr auto megabyte = 1024_size * 1024_size;
+
+response_cache::response_cache(size_t megabytes) NOEXCEPT
+  : budget_(ceilinged_multiply(megabytes, megabyte))
+{
+}
+
+std::string response_cache::key(std::string_view interface,
+    std::string_view method, std::string_view params,
+    std::string_view media) NOEXCEPT
+{
+    std::string out{};
+    out.reserve(interface.size() + method.size() + params.size() +
+        media.size() + 3u);
+    out.append(interface).append("/").append(method).append("/")
+        .append(params).append("/").append(media);
+    return out;
+}
+
+response_cache::bytes_ptr response_cache::get(const node::query& query,
+    const std::string& key) NOEXCEPT
+{
+    if (is_zero(budget_))
+        return {};
+
+    entry found{};
+    {
+        std::unique_lock lock{ mutex_ };
+        const auto it = index_.find(key);
+        if (it == index_.end())
+            return {};
+
+        entries_.splice(entries_.begin(), entries_, it->second);
+        found = *it->second;
+    }
+
+    // A stale response is replaced upon put, or evicted upon reorganization.
+    return is_confirmed(query, found.link, found.height) ? found.response :
+        bytes_ptr{};
+}
+
+response_cache::bytes_ptr response_cache::put(const node::query& query,
+    const std::string& key, const database::header_link& link,
+    std::string&& response) NOEXCEPT
+{
+    auto value = std::make_shared<const std::string>(std::move(response));
+
+    size_t height{};
+    if (is_zero(budget_) || !query.get_height(height, link) ||
+        !is_confirmed(query, link.value, height))
+        return value;
+
+    entry item{ key, link.value, height, value };
+    const auto bytes = footprint(item);
+    if (bytes > budget_)
+        return value;
+
+    std::unique_lock lock{ mutex_ };
+    if (const auto it = index_.find(key); it != index_.end())
+        erase(it->second);
+
+    entries_.push_front(std::move(item));
+    index_.emplace(entries_.front().key, entries_.begin());
+    size_ += bytes;
+
+    while (size_ > budget_)
+        erase(std::prev(entries_.end()));
+
+    return value;
+}
+
+void response_cache::reorganized(size_t branch_height) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        if (it->height > branch_height)
+            it = erase(it);
+        else
+            ++it;
+    }
+}
+
+size_t response_cache::size() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return size_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t response_cache::footprint(const entry& entry) NOEXCEPT
+{
+    return entry.key.size() + entry.response->size();
+}
+
+bool response_cache::is_confirmed(const node::query& query,
+    node::header_t link, size_t height) NOEXCEPT
+{
+    return query.to_confirmed(height).value == link;
+}
+
+response_cache::entries::iterator response_cache::erase(
+    entries::iterator it) NOEXCEPT
+{
+    size_ -= footprint(*it);
+    index_.erase(it->key);
+    return entries_.erase(it);
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
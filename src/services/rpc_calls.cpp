@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/rpc_calls.hpp>
+
+#include <mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+uint64_t rpc_calls::begin(const std::string& method) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    if (calls_.size() >= maximum_calls)
+        return {};
+
+    // Identifiers are never reused, zero is reserved for rejection.
+    const auto identifier = ++next_;
+    calls_.emplace(identifier, call{ method, clock::now() });
+    return identifier;
+}
+
+void rpc_calls::end(uint64_t identifier) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    calls_.erase(identifier);
+}
+
+rpc_calls::calls rpc_calls::active() const NOEXCEPT
+{
+    calls out{};
+    std::unique_lock lock{ mutex_ };
+    out.reserve(calls_.size());
+    for (const auto& entry: calls_)
+        out.push_back(entry.second);
+
+    return out;
+}
+
+size_t rpc_calls::size() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return calls_.size();
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/scripthash_index.hpp>
+
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+code scripthash_index::touched(keys& out, const node::query& query,
+    const database::header_link& link, uint64_t channel) NOEXCEPT
+{
+    if (find(out, link, channel))
+        return error::success;
+
+    // Concurrent first requests for a block may both read it, race is ok.
+    const auto block = query.get_block(link, false);
+    if (!block || !query.populate_without_metadata(*block))
+        return error::not_found;
+
+    scripthash_set set{};
+    touched_scripthashes(set, *block);
+    touched(out, link, set, channel);
+    return error::success;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
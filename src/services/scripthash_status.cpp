@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/scripthash_status.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Subscriptions.
+// ----------------------------------------------------------------------------
+
+code scripthash_status::subscribe(hash_digest& out, const node::query& query,
+    const std::atomic_bool& cancel, const hash_digest& key, size_t limit,
+    bool turbo) NOEXCEPT
+{
+    // The subscriber holds the entry in the table while it is computed.
+    entry_ptr item{};
+    {
+        std::unique_lock lock{ mutex_ };
+        auto& at = entries_[key];
+        if (!at)
+            at = std::make_shared<entry>();
+
+        ++at->subscribers;
+        item = at;
+    }
+
+    code ec{};
+    {
+        std::unique_lock lock{ item->mutex };
+        if (!(ec = update(*item, query, cancel, key, limit, turbo)))
+            out = item->status;
+    }
+
+    if (ec)
+        unsubscribe(key);
+
+    return ec;
+}
+
+void scripthash_status::unsubscribe(const hash_digest& key) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    const auto it = entries_.find(key);
+    if (it != entries_.end() && is_zero(--it->second->subscribers))
+        entries_.erase(it);
+}
+
+size_t scripthash_status::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return entries_.size();
+}
+
+size_t scripthash_status::memory() const NOEXCEPT
+{
+    // Each entry is a map node (and bucket pointer) and its shared entry.
+    using node = std::pair<const hash_digest, entry_ptr>;
+    constexpr auto fixed = sizeof(node) + sizeof(void*) + sizeof(entry);
+
+    size_t bytes{};
+    for (const auto& item: entries())
+    {
+        std::unique_lock lock{ item->mutex };
+        bytes += fixed + item->checkpoints.capacity() * sizeof(checkpoint);
+    }
+
+    return bytes;
+}
+
+// Status.
+// ----------------------------------------------------------------------------
+
+code scripthash_status::status(hash_digest& out, const node::query& query,
+    const std::atomic_bool& cancel, const hash_digest& key,
+    const database::header_link& link, size_t limit, bool turbo) NOEXCEPT
+{
+    const auto item = find(key);
+    if (!item)
+        return error::not_found;
+
+    std::unique_lock lock{ item->mutex };
+    if (link.is_terminal() || item->link != link)
+    {
+        if (const auto ec = update(*item, query, cancel, key, limit, turbo))
+            return ec;
+
+        item->link = link;
+    }
+
+    out = item->status;
+    return error::success;
+}
+
+void scripthash_status::reorganized(size_t branch_height) NOEXCEPT
+{
+    for (const auto& item: entries())
+    {
+        std::unique_lock lock{ item->mutex };
+        rewind_checkpoint(*item, branch_height);
+    }
+}
+
+void scripthash_status::reset() NOEXCEPT
+{
+    for (const auto& item: entries())
+    {
+        std::unique_lock lock{ item->mutex };
+        item->checkpoints.clear();
+        rewind_checkpoint(*item, zero);
+    }
+}
+
+// private/static
+// ----------------------------------------------------------------------------
+
+// Fold history above the cursor, confirmed into the retained midstate and
+// unconfirmed into a copy from which the status is obtained.
+code scripthash_status::update(entry& item, const node::query& query,
+    const std::atomic_bool& cancel, const hash_digest& key, size_t limit,
+    bool turbo) NOEXCEPT
+{
+    database::histories history{};
+    if (const auto ec = query.get_history(cancel, item.cursor, history, key,
+        limit, turbo))
+        return ec;
+
+    auto it = history.cbegin();
+    while (it != history.cend() && it->confirmed())
+        write_status(item.accumulator, *it++);
+
+    if (it != history.cbegin())
+    {
+        item.folded = true;
+        save_checkpoint(item);
+    }
+
+    // The status is always recomputed, as a rewound or emptied mempool state
+    // may have no history above the cursor. No history is the null status.
+    if (!item.folded && it == history.cend())
+    {
+        item.status = {};
+        return error::success;
+    }
+
+    midstate copy = item.accumulator;
+    while (it != history.cend())
+        write_status(copy, *it++);
+
+    item.status = copy.flush();
+    return error::success;
+}
+
+void scripthash_status::write_status(midstate& accumulator,
+    const database::history& history) NOEXCEPT
+{
+    // Height is zero (rooted) or max_size_t for unconfirmed history txs.
+    accumulator.write(encode_hash(history.tx.hash()));
+    accumulator.write(":");
+    accumulator.write(std::to_string(to_signed(history.tx.height())));
+    accumulator.write(":");
+}
+
+// Retain the confirmed midstate at the cursor, dropping the oldest if full.
+void scripthash_status::save_checkpoint(entry& item) NOEXCEPT
+{
+    auto& checkpoints = item.checkpoints;
+    if (checkpoints.size() == maximum_checkpoints)
+        checkpoints.erase(checkpoints.begin());
+
+    checkpoints.emplace_back(item.cursor, item.accumulator);
+}
+
+// Restore the most recent checkpoint at or below the branch point, otherwise
+// reset to the initial (IV) state, so that only history above it is refolded.
+// The cached link is invalidated, so the next request of any link updates
+// (and recomputes) the status.
+void scripthash_status::rewind_checkpoint(entry& item,
+    size_t branch_height) NOEXCEPT
+{
+    item.link = {};
+    auto& checkpoints = item.checkpoints;
+    while (!checkpoints.empty())
+    {
+        const auto& last = checkpoints.back();
+        if (!last.cursor.is_terminal() && last.cursor.value <= branch_height)
+        {
+            item.cursor = last.cursor;
+            item.accumulator = last.accumulator;
+            item.folded = true;
+            return;
+        }
+
+        checkpoints.pop_back();
+    }
+
+    // Reset (not flush) the accumulator to its initial (IV) state; flush()
+    // pads in place, leaving non-IV state that would poison re-accumulation.
+    item.accumulator.reset();
+    item.folded = false;
+    item.cursor = {};
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+scripthash_status::entry_ptr scripthash_status::find(
+    const hash_digest& key) const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    const auto it = entries_.find(key);
+    return it == entries_.end() ? entry_ptr{} : it->second;
+}
+
+std::vector<scripthash_status::entry_ptr>
+scripthash_status::entries() const NOEXCEPT
+{
+    std::vector<entry_ptr> out{};
+    std::shared_lock lock{ mutex_ };
+    out.reserve(entries_.size());
+    for (const auto& pair: entries_)
+        out.push_back(pair.second);
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/subscription_usage.hpp>
+
+#include <atomic>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+constexpr auto relaxed = std::memory_order_relaxed;
+
+// Unsigned wraparound of the intermediate sum is well defined, and each
+// channel retracts no more than it has contributed.
+void subscription_usage::update(const totals& prior,
+    const totals& current) NOEXCEPT
+{
+    subscriptions_.fetch_add(current.subscriptions - prior.subscriptions,
+        relaxed);
+    bytes_.fetch_add(current.bytes - prior.bytes, relaxed);
+}
+
+subscription_usage::totals subscription_usage::get() const NOEXCEPT
+{
+    return { subscriptions_.load(relaxed), bytes_.load(relaxed) };
+}
+
+} // namespace server
+} // namespace libbitcoin
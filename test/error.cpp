@@ -281,4 +281,13 @@ BOOST_AUTO_TEST_CASE(error_t__code__server_error__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "server_error");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__server_busy__true_expected_message)
+{
+    constexpr auto value = error::server_busy;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "server_busy");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -89,6 +89,7 @@ static_assert(bitcoind_served("getchaintips"));
 static_assert(bitcoind_served("getdifficulty"));
 static_assert(bitcoind_served("verifymessage"));
 static_assert(bitcoind_served("getindexinfo"));
+static_assert(bitcoind_served("submitpackage"));
 
 // Moved from the btcd interface (btcd serves them by session attachment).
 static_assert(bitcoind_served("help"));
@@ -128,7 +129,7 @@ static_assert(bitcoind_notifications_methods::names == "getzmqnotifications");
 static_assert(bitcoind_test_methods::names == "");
 static_assert(bitcoind_transaction_methods::names ==
     "createrawtransaction decoderawtransaction getrawtransaction "
-    "sendrawtransaction testmempoolaccept");
+    "sendrawtransaction testmempoolaccept submitpackage");
 static_assert(bitcoind_utility_methods::names ==
     "decodescript validateaddress createmultisig verifymessage getindexinfo");
 static_assert(bitcoind_wallet_methods::names == "");
@@ -160,6 +160,33 @@ BOOST_AUTO_TEST_CASE(parsers__admin_target__event_subscribe_extra_segment__extra
     BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/event/subscribe/extra"), server::error::extra_segment);
 }
 
+// subscriptions
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__subscriptions_valid__expected)
+{
+    const std::string path = "/v42/subscriptions";
+
+    request_t request{};
+    BOOST_REQUIRE(!admin_target(request, path));
+    BOOST_REQUIRE_EQUAL(request.method, "subscriptions");
+    BOOST_REQUIRE(request.params.has_value());
+
+    const auto& params = request.params.value();
+    BOOST_REQUIRE(std::holds_alternative<object_t>(params));
+
+    const auto& object = std::get<object_t>(request.params.value());
+    BOOST_REQUIRE_EQUAL(object.size(), 1u);
+
+    const auto version = std::get<uint8_t>(object.at("version").value());
+    BOOST_REQUIRE_EQUAL(version, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__subscriptions_extra_segment__extra_segment)
+{
+    request_t out{};
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/subscriptions/extra"), server::error::extra_segment);
+}
+
 // Cross-interface targets (native grammar is not admin grammar).
 
 BOOST_AUTO_TEST_CASE(parsers__admin_target__native_target__invalid_target)
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_touched_tests)
+
+using namespace system;
+using namespace system::chain;
+
+static const script script1{ operations{ operation{ opcode::op_1 } } };
+static const script script2{ operations{ operation{ opcode::op_2 } } };
+static const script script3{ operations{ operation{ opcode::op_3 } } };
+
+static block make_block(transactions&& txs) NOEXCEPT
+{
+    return { header{ 1, null_hash, null_hash, 42, 0x1d00ffff, 0 },
+        std::move(txs) };
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_scripthashes__coinbase_only__output_script)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 }
+    });
+
+    scripthash_set out{};
+    server::touched_scripthashes(out, block);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE(out.contains(script1.hash()));
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_scripthashes__populated_prevout__output_and_prevout_scripts)
+{
+    transaction tx{ 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+        outputs{ { 42, script2 } }, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(100, script3);
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        std::move(tx)
+    });
+
+    scripthash_set out{};
+    server::touched_scripthashes(out, block);
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE(out.contains(script1.hash()));
+    BOOST_REQUIRE(out.contains(script2.hash()));
+    BOOST_REQUIRE(out.contains(script3.hash()));
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_scripthashes__unpopulated_prevout__output_scripts)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        { 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } }, outputs{ { 42, script1 } }, 0 }
+    });
+
+    scripthash_set out{};
+    server::touched_scripthashes(out, block);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE(out.contains(script1.hash()));
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_outpoints__coinbase_only__created_outputs)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } },
+            outputs{ { 42, script1 }, { 24, script2 } }, 0 }
+    });
+
+    const auto hash = block.transactions_ptr()->front()->hash(false);
+    point_set out{};
+    server::touched_outpoints(out, block);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE(out.contains(point{ hash, 0 }));
+    BOOST_REQUIRE(out.contains(point{ hash, 1 }));
+    BOOST_REQUIRE(!out.contains(point{}));
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_outpoints__spending_tx__created_outputs_and_prevouts)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        { 1, inputs{ { point{ one_hash, 3 }, script{}, 0 } }, outputs{ { 42, script2 } }, 0 }
+    });
+
+    const auto& txs = *block.transactions_ptr();
+    point_set out{};
+    server::touched_outpoints(out, block);
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_REQUIRE(out.contains(point{ txs.front()->hash(false), 0 }));
+    BOOST_REQUIRE(out.contains(point{ txs.back()->hash(false), 0 }));
+    BOOST_REQUIRE(out.contains(point{ one_hash, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(block_touched__touched_address__paid_and_spent__both_outpoints)
+{
+    transaction tx{ 1, inputs{ { point{ one_hash, 7 }, script{}, 0 } },
+        outputs{ { 42, script2 }, { 43, script1 } }, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(100, script1);
+    const auto hash = tx.hash(false);
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script2 } }, 0 },
+        std::move(tx)
+    });
+
+    database::outpoints out{};
+    server::touched_address(out, block, script1.hash());
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE(out.contains(outpoint{ point{ hash, 1 }, 43 }));
+    BOOST_REQUIRE(out.contains(outpoint{ point{ one_hash, 7 }, 100 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
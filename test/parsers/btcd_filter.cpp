@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(btcd_filter_tests)
+
+using namespace system;
+using namespace system::chain;
+
+static const script script1{ operations{ operation{ opcode::op_1 } } };
+static const script script2{ operations{ operation{ opcode::op_2 } } };
+static const script script3{ operations{ operation{ opcode::op_3 } } };
+
+static block make_block(transactions&& txs) NOEXCEPT
+{
+    return { header{ 1, null_hash, null_hash, 42, 0x1d00ffff, 0 },
+        std::move(txs) };
+}
+
+BOOST_AUTO_TEST_CASE(btcd_filter__filter_block__empty_watches__empty)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 }
+    });
+
+    BOOST_REQUIRE(btcd::filter_block(block, {}, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(btcd_filter__filter_block__output_key__matched_in_block_order)
+{
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        { 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } }, outputs{ { 42, script2 } }, 0 },
+        { 1, inputs{ { point{ one_hash, 1 }, script{}, 0 } }, outputs{ { 42, script1 } }, 0 }
+    });
+
+    const auto txs = btcd::filter_block(block, { script1.hash() }, {});
+    BOOST_REQUIRE_EQUAL(txs.size(), 2u);
+    BOOST_REQUIRE(txs.front() == block.transactions_ptr()->front());
+    BOOST_REQUIRE(txs.back() == block.transactions_ptr()->back());
+}
+
+BOOST_AUTO_TEST_CASE(btcd_filter__filter_block__spent_point__matched)
+{
+    const point spent{ one_hash, 1 };
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        { 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } }, outputs{ { 42, script2 } }, 0 },
+        { 1, inputs{ { spent, script{}, 0 } }, outputs{ { 42, script2 } }, 0 }
+    });
+
+    const auto txs = btcd::filter_block(block, {}, { spent });
+    BOOST_REQUIRE_EQUAL(txs.size(), 1u);
+    BOOST_REQUIRE(txs.front() == block.transactions_ptr()->back());
+}
+
+BOOST_AUTO_TEST_CASE(btcd_filter__filter_block__populated_prevout_key__matched)
+{
+    transaction tx{ 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+        outputs{ { 42, script2 } }, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(100, script3);
+    const auto block = make_block(
+    {
+        { 1, inputs{ { point{}, script{}, 0 } }, outputs{ { 42, script1 } }, 0 },
+        std::move(tx)
+    });
+
+    const auto txs = btcd::filter_block(block, { script3.hash() }, {});
+    BOOST_REQUIRE_EQUAL(txs.size(), 1u);
+    BOOST_REQUIRE(txs.front() == block.transactions_ptr()->back());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(byte_range_tests)
+
+// parse_range
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__empty__full)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "", 1000) == range_request::full);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__unsupported__full)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "items=0-9", 1000) ==
+        range_request::full);
+    BOOST_REQUIRE(parse_range(range, "bytes=0-1,5-6", 1000) ==
+        range_request::full);
+    BOOST_REQUIRE(parse_range(range, "bytes=9-0", 1000) ==
+        range_request::full);
+    BOOST_REQUIRE(parse_range(range, "bytes=a-9", 1000) ==
+        range_request::full);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__bounded__partial_clamped)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "BYTES=10-19", 1000) ==
+        range_request::partial);
+    BOOST_REQUIRE_EQUAL(range.first, 10u);
+    BOOST_REQUIRE_EQUAL(range.last, 19u);
+    BOOST_REQUIRE_EQUAL(range.size, 1000u);
+    BOOST_REQUIRE_EQUAL(range.length(), 10u);
+
+    BOOST_REQUIRE(parse_range(range, "bytes=990-2000", 1000) ==
+        range_request::partial);
+    BOOST_REQUIRE_EQUAL(range.first, 990u);
+    BOOST_REQUIRE_EQUAL(range.last, 999u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__open_ended__partial_remainder)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "bytes=999-", 1000) ==
+        range_request::partial);
+    BOOST_REQUIRE_EQUAL(range.first, 999u);
+    BOOST_REQUIRE_EQUAL(range.last, 999u);
+    BOOST_REQUIRE_EQUAL(range.length(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__suffix__partial_final_bytes)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "bytes=-10", 1000) ==
+        range_request::partial);
+    BOOST_REQUIRE_EQUAL(range.first, 990u);
+    BOOST_REQUIRE_EQUAL(range.last, 999u);
+
+    BOOST_REQUIRE(parse_range(range, "bytes=-2000", 1000) ==
+        range_request::partial);
+    BOOST_REQUIRE_EQUAL(range.first, 0u);
+    BOOST_REQUIRE_EQUAL(range.last, 999u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__parse_range__beyond_size__unsatisfiable)
+{
+    byte_range range{};
+    BOOST_REQUIRE(parse_range(range, "bytes=1000-", 1000) ==
+        range_request::unsatisfiable);
+    BOOST_REQUIRE(parse_range(range, "bytes=-0", 1000) ==
+        range_request::unsatisfiable);
+    BOOST_REQUIRE(parse_range(range, "bytes=0-", 0) ==
+        range_request::unsatisfiable);
+}
+
+// to_content_range
+
+BOOST_AUTO_TEST_CASE(parsers__to_content_range__satisfiable__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_content_range(byte_range{ 10, 19, 1000 }),
+        "bytes 10-19/1000");
+}
+
+BOOST_AUTO_TEST_CASE(parsers__to_content_range__unsatisfiable__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_content_range(1000u), "bytes */1000");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
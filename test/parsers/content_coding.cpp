@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <boost/beast/zlib.hpp>
+#include <boost/crc.hpp>
+
+BOOST_AUTO_TEST_SUITE(content_coding_tests)
+
+using namespace system;
+namespace zlib = boost::beast::zlib;
+
+// Inflate the raw (RFC 1951) stream within a coding wrapper.
+static bool inflate(std::string& out, std::string_view raw,
+    size_t size) NOEXCEPT
+{
+    out.assign(add1(size), '\0');
+    zlib::inflate_stream stream{};
+    zlib::z_params params{};
+    params.next_in = raw.data();
+    params.avail_in = raw.size();
+    params.next_out = out.data();
+    params.avail_out = out.size();
+
+    boost::beast::error_code ec{};
+    while (!ec)
+        stream.write(params, zlib::Flush::sync, ec);
+
+    out.resize(params.total_out);
+    return ec == zlib::error::end_of_stream;
+}
+
+// A compressible body that is not a single repeated byte.
+static std::string text_body() NOEXCEPT
+{
+    std::string out{};
+    for (auto height = 0u; height < 2000u; ++height)
+        out.append("{\"height\":").append(std::to_string(height))
+            .append(",\"hash\":\"").append(std::to_string(height * 7919u))
+            .append("\"}");
+
+    return out;
+}
+
+// negotiate_coding
+
+BOOST_AUTO_TEST_CASE(parsers__negotiate_coding__empty__identity)
+{
+    BOOST_REQUIRE(negotiate_coding("") == content_coding::identity);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__negotiate_coding__unsupported__identity)
+{
+    BOOST_REQUIRE(negotiate_coding("br, zstd, identity") ==
+        content_coding::identity);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__negotiate_coding__gzip_and_deflate__gzip)
+{
+    BOOST_REQUIRE(negotiate_coding("deflate, GZIP, br") ==
+        content_coding::gzip);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__negotiate_coding__quality__preferred)
+{
+    BOOST_REQUIRE(negotiate_coding("gzip;q=0.5, deflate") ==
+        content_coding::deflate);
+    BOOST_REQUIRE(negotiate_coding("gzip ; q=0, deflate;q=0.001") ==
+        content_coding::deflate);
+    BOOST_REQUIRE(negotiate_coding("gzip;q=0.000, deflate;q=0") ==
+        content_coding::identity);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__negotiate_coding__wildcard__unlisted_quality)
+{
+    BOOST_REQUIRE(negotiate_coding("*") == content_coding::gzip);
+    BOOST_REQUIRE(negotiate_coding("gzip;q=0, *;q=0.2") ==
+        content_coding::deflate);
+    BOOST_REQUIRE(negotiate_coding("*;q=0") == content_coding::identity);
+}
+
+// from_content_coding
+
+BOOST_AUTO_TEST_CASE(parsers__from_content_coding__codings__field_values)
+{
+    BOOST_REQUIRE_EQUAL(from_content_coding(content_coding::identity),
+        "identity");
+    BOOST_REQUIRE_EQUAL(from_content_coding(content_coding::deflate),
+        "deflate");
+    BOOST_REQUIRE_EQUAL(from_content_coding(content_coding::gzip), "gzip");
+}
+
+// compress
+
+BOOST_AUTO_TEST_CASE(parsers__compress__identity__empty)
+{
+    BOOST_REQUIRE(compress("42", content_coding::identity).empty());
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__gzip__wrapped_smaller)
+{
+    const std::string body(4096, 'a');
+    const auto out = compress(body, content_coding::gzip);
+    BOOST_REQUIRE_LT(out.size(), body.size());
+    BOOST_REQUIRE_EQUAL(out.at(0), '\x1f');
+    BOOST_REQUIRE_EQUAL(out.at(1), '\x8b');
+    BOOST_REQUIRE_EQUAL(out.at(2), '\x08');
+
+    // The trailer ends with the little-endian body size.
+    BOOST_REQUIRE_EQUAL(out.substr(out.size() - 4u),
+        std::string("\x00\x10\x00\x00", 4));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__deflate__wrapped_smaller)
+{
+    const std::string body(4096, 'a');
+    const auto out = compress(body, content_coding::deflate);
+    BOOST_REQUIRE_LT(out.size(), body.size());
+    BOOST_REQUIRE_EQUAL(out.at(0), '\x78');
+    BOOST_REQUIRE_EQUAL(out.at(1), '\x9c');
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__empty_deflate__adler32_trailer)
+{
+    // Adler-32 of the empty body is one.
+    const auto out = compress("", content_coding::deflate);
+    BOOST_REQUIRE_GT(out.size(), 6u);
+    BOOST_REQUIRE_EQUAL(out.substr(out.size() - 4u),
+        std::string("\x00\x00\x00\x01", 4));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__gzip__round_trip)
+{
+    const auto body = text_body();
+    const auto out = compress(body, content_coding::gzip);
+    BOOST_REQUIRE_GT(out.size(), 18u);
+    BOOST_REQUIRE_LT(out.size(), body.size());
+
+    // 10 byte header and 8 byte trailer (crc32, size) wrap the raw stream.
+    const std::string_view coded{ out };
+    const auto raw = coded.substr(10u, out.size() - 18u);
+    std::string inflated{};
+    BOOST_REQUIRE(inflate(inflated, raw, body.size()));
+    BOOST_REQUIRE_EQUAL(inflated, body);
+
+    boost::crc_32_type crc{};
+    crc.process_bytes(body.data(), body.size());
+    const auto checksum = crc.checksum();
+    const auto trailer = coded.substr(out.size() - 8u);
+    BOOST_REQUIRE_EQUAL(static_cast<uint8_t>(trailer.at(0)), checksum & 0xffu);
+    BOOST_REQUIRE_EQUAL(static_cast<uint8_t>(trailer.at(3)), checksum >> 24u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__deflate__round_trip)
+{
+    const auto body = text_body();
+    const auto out = compress(body, content_coding::deflate);
+    BOOST_REQUIRE_GT(out.size(), 6u);
+    BOOST_REQUIRE_LT(out.size(), body.size());
+
+    // 2 byte header and 4 byte trailer (adler32) wrap the raw stream.
+    const std::string_view coded{ out };
+    const auto raw = coded.substr(2u, out.size() - 6u);
+    std::string inflated{};
+    BOOST_REQUIRE(inflate(inflated, raw, body.size()));
+    BOOST_REQUIRE_EQUAL(inflated, body);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__compress__empty_gzip__round_trip)
+{
+    const auto out = compress("", content_coding::gzip);
+    BOOST_REQUIRE_GT(out.size(), 18u);
+    const std::string_view coded{ out };
+    std::string inflated{};
+    BOOST_REQUIRE(inflate(inflated, coded.substr(10u, out.size() - 18u), 0));
+    BOOST_REQUIRE(inflated.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(entity_tag_tests)
+
+using namespace system;
+using namespace network::http;
+
+constexpr auto json = media_type::application_json;
+constexpr auto data = media_type::application_octet_stream;
+
+// entity_tag
+
+BOOST_AUTO_TEST_CASE(parsers__entity_tag__same_resource__same_quoted_tag)
+{
+    const auto tag = entity_tag("native", "block", one_hash, "w", json);
+    BOOST_REQUIRE_EQUAL(tag.size(), 2u + two * hash_size);
+    BOOST_REQUIRE_EQUAL(tag.front(), '"');
+    BOOST_REQUIRE_EQUAL(tag.back(), '"');
+    BOOST_REQUIRE_EQUAL(entity_tag("native", "block", one_hash, "w", json), tag);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_tag__distinct_resources__distinct_tags)
+{
+    const auto tag = entity_tag("native", "block", one_hash, "w", json);
+    BOOST_REQUIRE_NE(entity_tag("rest", "block", one_hash, "w", json), tag);
+    BOOST_REQUIRE_NE(entity_tag("native", "header", one_hash, "w", json), tag);
+    BOOST_REQUIRE_NE(entity_tag("native", "block", null_hash, "w", json), tag);
+    BOOST_REQUIRE_NE(entity_tag("native", "block", one_hash, "", json), tag);
+    BOOST_REQUIRE_NE(entity_tag("native", "block", one_hash, "w", data), tag);
+}
+
+// entity_match
+
+BOOST_AUTO_TEST_CASE(parsers__entity_match__empty__false)
+{
+    BOOST_REQUIRE(!entity_match("", "\"42\""));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_match__wildcard__false)
+{
+    BOOST_REQUIRE(!entity_match(" * ", "\"42\""));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_wildcard__wildcard__true)
+{
+    BOOST_REQUIRE(entity_wildcard(" * "));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_wildcard__tag__false)
+{
+    BOOST_REQUIRE(!entity_wildcard("\"42\""));
+    BOOST_REQUIRE(!entity_wildcard(""));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_match__listed__true)
+{
+    BOOST_REQUIRE(entity_match("\"42\"", "\"42\""));
+    BOOST_REQUIRE(entity_match("\"24\", \"42\"", "\"42\""));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_match__weak_listed__true)
+{
+    BOOST_REQUIRE(entity_match("W/\"42\"", "\"42\""));
+}
+
+BOOST_AUTO_TEST_CASE(parsers__entity_match__unlisted__false)
+{
+    BOOST_REQUIRE(!entity_match("\"24\", \"420\"", "\"42\""));
+    BOOST_REQUIRE(!entity_match("42", "\"42\""));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
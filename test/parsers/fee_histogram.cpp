@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fee_histogram_tests)
+
+using namespace system;
+using namespace system::chain;
+
+BOOST_AUTO_TEST_CASE(fee_histogram__compact_fee_rates__empty__empty)
+{
+    BOOST_REQUIRE(compact_fee_rates({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__compact_fee_rates__below_bin_size__empty)
+{
+    const fee_rates rates{ { 10, 100 }, { 5, 100 } };
+    BOOST_REQUIRE(compact_fee_rates(rates, 1'000).empty());
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__compact_fee_rates__descending__expected_bins)
+{
+    // The second bin requires more than 1100 (bin size grows by 10%).
+    const fee_rates rates{ { 1, 600 }, { 20, 600 }, { 10, 600 }, { 5, 600 } };
+    const auto bins = compact_fee_rates(rates, 1'000);
+    BOOST_REQUIRE_EQUAL(bins.size(), 2u);
+    BOOST_REQUIRE_EQUAL(bins.front().first, 10u);
+    BOOST_REQUIRE_EQUAL(bins.front().second, 1'200u);
+    BOOST_REQUIRE_EQUAL(bins.back().first, 1u);
+    BOOST_REQUIRE_EQUAL(bins.back().second, 1'200u);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__compact_fee_rates__lump__closes_prior_bin)
+{
+    const fee_rates rates{ { 20, 100 }, { 10, 5'000 } };
+    const auto bins = compact_fee_rates(rates, 1'000);
+    BOOST_REQUIRE_EQUAL(bins.size(), 2u);
+    BOOST_REQUIRE_EQUAL(bins.front().first, 20u);
+    BOOST_REQUIRE_EQUAL(bins.front().second, 100u);
+    BOOST_REQUIRE_EQUAL(bins.back().first, 10u);
+    BOOST_REQUIRE_EQUAL(bins.back().second, 5'000u);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__fee_histogram__coinbase_only__empty)
+{
+    const block instance
+    {
+        header{ 1, null_hash, null_hash, 42, 0x1d00ffff, 0 },
+        transactions
+        {
+            { 1, inputs{ { point{}, script{}, 0 } },
+                outputs{ { 50, script{} } }, 0 }
+        }
+    };
+
+    BOOST_REQUIRE(fee_histogram(instance).empty());
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__fee_histogram__unpopulated_prevout__skipped)
+{
+    const block instance
+    {
+        header{ 1, null_hash, null_hash, 42, 0x1d00ffff, 0 },
+        transactions
+        {
+            { 1, inputs{ { point{}, script{}, 0 } },
+                outputs{ { 50, script{} } }, 0 },
+            { 1, inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+                outputs{ { 40, script{} } }, 0 }
+        }
+    };
+
+    BOOST_REQUIRE(fee_histogram(instance).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -106,6 +106,41 @@ BOOST_AUTO_TEST_CASE(partial_merkle__single_tx__is_leaf_root)
     BOOST_REQUIRE_EQUAL(branch.front(), txids.front());
 }
 
+// merkle levels
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(partial_merkle__to_merkle_levels__empty__empty)
+{
+    BOOST_REQUIRE(server::to_merkle_levels({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(partial_merkle__to_merkle_levels__odd_tx__txids_and_root)
+{
+    const auto txids = make_txids(7);
+    const auto levels = server::to_merkle_levels(hashes{ txids });
+    BOOST_REQUIRE_EQUAL(levels.size(), 4u);
+    BOOST_REQUIRE_EQUAL(levels.front(), txids);
+    BOOST_REQUIRE_EQUAL(levels.back().size(), 1u);
+    BOOST_REQUIRE_EQUAL(levels.back().front(), full_root(txids));
+}
+
+BOOST_AUTO_TEST_CASE(partial_merkle__merkle_branch__all_positions__block_merkle_branch)
+{
+    const auto txids = make_txids(11);
+    const auto levels = server::to_merkle_levels(hashes{ txids });
+    for (size_t position{}; position < txids.size(); ++position)
+    {
+        BOOST_REQUIRE_EQUAL(server::merkle_branch(levels, position),
+            chain::block::merkle_branch(position, hashes{ txids }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(partial_merkle__merkle_branch__single_tx__empty)
+{
+    const auto levels = server::to_merkle_levels(make_txids(1));
+    BOOST_REQUIRE(server::merkle_branch(levels, 0).empty());
+}
+
 // malformed
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(tx_package_tests)
+
+using namespace system;
+using namespace system::chain;
+
+static const script script1{ operations{ operation{ opcode::op_1 } } };
+
+static transaction::cptr make_tx(const hash_digest& previous,
+    uint32_t index) NOEXCEPT
+{
+    return to_shared<transaction>(1,
+        inputs{ { point{ previous, index }, script{}, 0 } },
+        outputs{ { 42, script1 } }, 0);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__empty__invalid_argument)
+{
+    transaction_cptrs txs{};
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__oversized__invalid_argument)
+{
+    transaction_cptrs txs{};
+    for (uint32_t index{}; index <= maximum_package_count; ++index)
+        txs.push_back(make_tx(one_hash, index));
+
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__duplicate__invalid_argument)
+{
+    const auto tx = make_tx(one_hash, 0);
+    transaction_cptrs txs{ tx, tx };
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__conflicting__invalid_argument)
+{
+    const auto tx1 = make_tx(one_hash, 0);
+    const auto tx2 = to_shared<transaction>(2,
+        inputs{ { point{ one_hash, 0 }, script{}, 0 } },
+        outputs{ { 42, script1 } }, 0);
+
+    transaction_cptrs txs{ tx1, tx2 };
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__independent__order_preserved)
+{
+    const auto tx1 = make_tx(one_hash, 1);
+    const auto tx2 = make_tx(one_hash, 0);
+    transaction_cptrs txs{ tx1, tx2 };
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::success);
+    BOOST_REQUIRE_EQUAL(txs.size(), 2u);
+    BOOST_REQUIRE(txs.at(0) == tx1);
+    BOOST_REQUIRE(txs.at(1) == tx2);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__order_package__child_first__parent_first)
+{
+    const auto parent = make_tx(one_hash, 0);
+    const auto child = make_tx(parent->hash(false), 0);
+    transaction_cptrs txs{ child, parent };
+    BOOST_REQUIRE_EQUAL(order_package(txs), error::success);
+    BOOST_REQUIRE_EQUAL(txs.size(), 2u);
+    BOOST_REQUIRE(txs.at(0) == parent);
+    BOOST_REQUIRE(txs.at(1) == child);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__parse_package__not_string__invalid_argument)
+{
+    transaction_cptrs txs{};
+    const network::rpc::array_t raw{ true };
+    BOOST_REQUIRE_EQUAL(parse_package(txs, raw), error::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__populate_package__parent_and_child__child_prevout_populated)
+{
+    const auto parent = make_tx(one_hash, 0);
+    const auto child = make_tx(parent->hash(false), 0);
+    const transaction_cptrs txs{ parent, child };
+    populate_package(txs);
+    BOOST_REQUIRE(!parent->inputs_ptr()->front()->prevout);
+    BOOST_REQUIRE(child->inputs_ptr()->front()->prevout ==
+        parent->outputs_ptr()->front());
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__populate_package__invalid_index__unpopulated)
+{
+    const auto parent = make_tx(one_hash, 0);
+    const auto child = make_tx(parent->hash(false), 1);
+    const transaction_cptrs txs{ parent, child };
+    populate_package(txs);
+    BOOST_REQUIRE(!child->inputs_ptr()->front()->prevout);
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__reject_orphans__faulted_parent__descendants_faulted)
+{
+    const auto parent = make_tx(one_hash, 0);
+    const auto child = make_tx(parent->hash(false), 0);
+    const auto grandchild = make_tx(child->hash(false), 0);
+    const auto other = make_tx(one_hash, 1);
+    tx_package package{};
+    package.txs = { parent, child, grandchild, other };
+    package.faults = { error::invalid_argument, {}, {}, {} };
+    reject_orphans(package);
+    BOOST_REQUIRE_EQUAL(package.faults.at(0), error::invalid_argument);
+    BOOST_REQUIRE_EQUAL(package.faults.at(1),
+        system::error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(package.faults.at(2),
+        system::error::missing_previous_output);
+    BOOST_REQUIRE(!package.faults.at(3));
+}
+
+BOOST_AUTO_TEST_CASE(tx_package__reject_orphans__valid_parent__child_unfaulted)
+{
+    const auto parent = make_tx(one_hash, 0);
+    const auto child = make_tx(parent->hash(false), 0);
+    tx_package package{};
+    package.txs = { parent, child };
+    package.faults = { {}, {} };
+    reject_orphans(package);
+    BOOST_REQUIRE(!package.faults.at(0));
+    BOOST_REQUIRE(!package.faults.at(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
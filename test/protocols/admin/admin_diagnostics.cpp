@@ -248,4 +248,17 @@ BOOST_AUTO_TEST_CASE(admin__ws_event_subscribe__unfiltered_event__not_notified)
     BOOST_REQUIRE_EQUAL(frame.at("value").as_int64(), 2);
 }
 
+// subscriptions (http)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(admin__subscriptions__none__zero)
+{
+    const auto response = get_json("/v1/subscriptions?format=json");
+    REQUIRE_NO_THROW_TRUE(response.at("subscriptions").is_number());
+    REQUIRE_NO_THROW_TRUE(response.at("bytes").is_number());
+    REQUIRE_NO_THROW_TRUE(response.at("bytes_per_subscription").is_number());
+    BOOST_REQUIRE_EQUAL(response.at("subscriptions").to_number<uint64_t>(), 0u);
+    BOOST_REQUIRE_EQUAL(response.at("bytes_per_subscription").to_number<uint64_t>(), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -193,7 +193,6 @@ const std::vector<std::string> pending_methods
     "importmempool",
     "abortprivatebroadcast",
     "getprivatebroadcastinfo",
-    "submitpackage",
     "getblocktemplate",
     "getprioritisedtransactions",
     "prioritisetransaction",
@@ -529,6 +528,60 @@ BOOST_AUTO_TEST_CASE(bitcoind_rpc__testmempoolaccept__empty__error)
     BOOST_REQUIRE(has_error(response));
 }
 
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitpackage__empty__error)
+{
+    const auto response = rpc("submitpackage", "[[]]");
+    BOOST_REQUIRE(has_error(response));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitpackage__duplicate__error)
+{
+    const auto tx = encode_base16(test::block1.transactions_ptr()->front()->to_data(true));
+    const auto response = rpc("submitpackage", "[[\"" + tx + "\",\"" + tx + "\"]]");
+    BOOST_REQUIRE(has_error(response));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitpackage__coinbase__transaction_failed)
+{
+    const auto& tx = *test::block1.transactions_ptr()->front();
+    const auto response = rpc("submitpackage", "[[\"" + encode_base16(tx.to_data(true)) + "\"]]");
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_object());
+
+    const auto& result = response.at("result").as_object();
+    BOOST_REQUIRE_EQUAL(result.at("package_msg").as_string(), "transaction failed");
+    BOOST_REQUIRE(result.at("replaced-transactions").as_array().empty());
+
+    const auto& entry = result.at("tx-results").at(encode_hash(tx.hash(true)));
+    BOOST_REQUIRE_EQUAL(entry.at("txid").as_string(), encode_hash(tx.hash(false)));
+    BOOST_REQUIRE(entry.as_object().contains("error"));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitpackage__child_of_failed_parent__child_rejected)
+{
+    // The child precedes its parent, which fails as a loose coinbase.
+    const auto& parent = *test::block1.transactions_ptr()->front();
+    const chain::transaction child
+    {
+        0x01,
+        chain::inputs{ { chain::point{ parent.hash(false), 0 }, chain::script{}, chain::witness{}, 0 } },
+        chain::outputs{ { 0x01, chain::script{} } },
+        0x00
+    };
+
+    const auto response = rpc("submitpackage", "[[\"" +
+        encode_base16(child.to_data(true)) + "\",\"" +
+        encode_base16(parent.to_data(true)) + "\"]]");
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_object());
+
+    // The child is validated against its in-package parent, not the store,
+    // and is not accepted without it.
+    const auto& results = response.at("result").at("tx-results");
+    const auto& entry = results.at(encode_hash(child.hash(true)));
+    BOOST_REQUIRE_EQUAL(entry.at("error").as_string(),
+        code{ system::error::missing_previous_output }.message());
+    BOOST_REQUIRE(results.at(encode_hash(parent.hash(true))).as_object().contains("error"));
+}
+
 // network
 // ----------------------------------------------------------------------------
 
@@ -958,6 +1011,25 @@ BOOST_AUTO_TEST_CASE(bitcoind_rpc__batch__error_element__delivered_in_order)
     BOOST_REQUIRE_EQUAL(batch.at(2).at("result").as_int64(), 9);
 }
 
+// Elements are claimed by distinct subgroups and by the terminal responder.
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__batch__mixed_subgroups__ordered_responses)
+{
+    const auto response = rpc_body(
+        R"([{"jsonrpc":"2.0","id":1,"method":"getconnectioncount","params":[]},)"
+        R"({"jsonrpc":"2.0","id":2,"method":"nosuchmethod","params":[]},)"
+        R"({"jsonrpc":"2.0","id":3,"method":"getblockcount","params":[]}])");
+
+    BOOST_REQUIRE(response.is_array());
+    const auto& batch = response.as_array();
+    BOOST_REQUIRE_EQUAL(batch.size(), 3u);
+    BOOST_REQUIRE_EQUAL(batch.at(0).at("id").as_int64(), 1);
+    BOOST_REQUIRE_EQUAL(batch.at(0).at("result").as_int64(), 0);
+    BOOST_REQUIRE_EQUAL(batch.at(1).at("id").as_int64(), 2);
+    BOOST_REQUIRE(has_error(batch.at(1)));
+    BOOST_REQUIRE_EQUAL(batch.at(2).at("id").as_int64(), 3);
+    BOOST_REQUIRE_EQUAL(batch.at(2).at("result").as_int64(), 9);
+}
+
 BOOST_AUTO_TEST_CASE(bitcoind_rpc__batch__v1_second_element__closed_partial_batch)
 {
     // The batched v1 policy stop closes the open batch response (the first
@@ -1027,6 +1099,20 @@ BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblockchaininfo__websocket__expected)
     BOOST_REQUIRE_EQUAL(result.at("blocks").as_int64(), 9);
 }
 
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblock__websocket_deferred__block9)
+{
+    BOOST_REQUIRE(!ws_upgrade());
+
+    const auto response = ws_rpc("getblock", hash_param(test::block9_hash, "1"));
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(as_text(result.at("hash")), block9);
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 9);
+
+    // The channel context is restored for subsequent (non-deferred) frames.
+    const auto count = ws_rpc("getblockcount");
+    BOOST_REQUIRE_EQUAL(count.at("result").as_int64(), 9);
+}
+
 BOOST_AUTO_TEST_CASE(bitcoind_rpc__unknown_method__websocket__error_keeps_connection)
 {
     BOOST_REQUIRE(!ws_upgrade());
@@ -266,6 +266,29 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_block_header__proof_example__expected)
     BOOST_REQUIRE_EQUAL(branch.at(3).as_string(), expected_branch[3]);
 }
 
+// The checkpoint tree is extended (not rebuilt) by a subsequent checkpoint.
+BOOST_AUTO_TEST_CASE(electrum__blockchain_block_header__ascending_checkpoints__expected_roots)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_6));
+
+    using namespace test;
+    const auto first = get(R"({"id":47,"method":"blockchain.block.header","params":[1,1]})" "\n");
+    REQUIRE_NO_THROW_TRUE(first.at("result").is_object());
+    BOOST_REQUIRE_EQUAL(first.at("result").as_object().at("root").as_string(), encode_hash(root01));
+
+    const auto second = get(R"({"id":48,"method":"blockchain.block.header","params":[3,7]})" "\n");
+    REQUIRE_NO_THROW_TRUE(second.at("result").is_object());
+
+    const auto& result = second.at("result").as_object();
+    BOOST_REQUIRE_EQUAL(result.at("root").as_string(), encode_hash(root07));
+
+    const auto& branch = result.at("branch").as_array();
+    BOOST_REQUIRE_EQUAL(branch.size(), 3u);
+    BOOST_REQUIRE_EQUAL(branch.at(0).as_string(), encode_hash(block2_hash));
+    BOOST_REQUIRE_EQUAL(branch.at(1).as_string(), encode_hash(root01));
+    BOOST_REQUIRE_EQUAL(branch.at(2).as_string(), encode_hash(root47));
+}
+
 BOOST_AUTO_TEST_CASE(electrum__blockchain_block_header__checkpoint_below_height__target_overflow)
 {
     BOOST_REQUIRE(handshake(electrum::version::v1_6));
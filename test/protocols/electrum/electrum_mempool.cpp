@@ -59,6 +59,16 @@ BOOST_AUTO_TEST_CASE(electrum__mempool_get_fee_histogram__extra_param__dropped)
 ////    BOOST_REQUIRE_EQUAL(result, not_implemented.value());
 ////}
 
+// The mock blocks are coinbase-only, so the simulated histogram is empty.
+BOOST_AUTO_TEST_CASE(electrum__mempool_get_fee_histogram__coinbase_only_top__empty)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_2));
+
+    const auto response = get(R"({"id":604,"method":"mempool.get_fee_histogram","params":[]})" "\n");
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_array());
+    BOOST_REQUIRE(response.at("result").as_array().empty());
+}
+
 // mempool.get_info
 
 BOOST_AUTO_TEST_CASE(electrum__mempool_get_info__insufficient_version__wrong_version)
@@ -197,6 +197,71 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_history__confirmed_and_
     BOOST_REQUIRE_EQUAL(tx3.at("tx_hash").as_string(), encode_hash(hash3));
 }
 
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_history__negative_from_height__invalid_argument)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+
+    const auto request = R"({"id":1009,"method":"blockchain.scripthash.get_history","params":["%1%",-1]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("error").as_object().at("code").is_int64());
+    BOOST_REQUIRE_EQUAL(response.at("error").as_object().at("code").as_int64(), invalid_argument.value());
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_history__from_confirmed_height__inclusive)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    const auto request = R"({"id":1010,"method":"blockchain.scripthash.get_history","params":["%1%",10]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_array());
+
+    const auto& history = response.at("result").as_array();
+    BOOST_REQUIRE_EQUAL(history.size(), 2u);
+    BOOST_REQUIRE_EQUAL(history.at(0).as_object().at("height").as_int64(), 10);
+    BOOST_REQUIRE_EQUAL(history.at(1).as_object().at("height").as_int64(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_history__from_above_confirmed__unconfirmed_only)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    const auto request = R"({"id":1011,"method":"blockchain.scripthash.get_history","params":["%1%",11]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_array());
+
+    const auto& history = response.at("result").as_array();
+    BOOST_REQUIRE_EQUAL(history.size(), 1u);
+    BOOST_REQUIRE_EQUAL(history.at(0).as_object().at("height").as_int64(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_history__batch__ordered_responses)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    const auto request =
+        R"([{"jsonrpc":"2.0","id":1007,"method":"blockchain.scripthash.get_history","params":["%1%"]},)"
+        R"({"jsonrpc":"2.0","id":1008,"method":"blockchain.scripthash.get_history","params":["%2%"]}])" "\n";
+    const auto response = get((boost_format(request) % found_scripthash % bogus_scripthash).str());
+
+    BOOST_REQUIRE(response.is_array());
+    const auto& batch = response.as_array();
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_REQUIRE_EQUAL(batch.at(0).at("id").as_int64(), 1007);
+    BOOST_REQUIRE_EQUAL(batch.at(1).at("id").as_int64(), 1008);
+    REQUIRE_NO_THROW_TRUE(batch.at(0).at("result").is_array());
+    REQUIRE_NO_THROW_TRUE(batch.at(1).at("result").is_array());
+    BOOST_REQUIRE(!batch.at(0).at("result").as_array().empty());
+    BOOST_REQUIRE(batch.at(1).at("result").as_array().empty());
+}
+
 // blockchain.scripthash.get_mempool
 
 BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_get_mempool__missing_arguments__dropped)
@@ -82,7 +82,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_address_subscribe__initialization__exp
 {
     BOOST_REQUIRE(handshake(electrum::version::v1_0));
 
-    // This validates the hash accumulator copy in get_scripthash_history() and incorporates
+    // This validates the hash accumulator copy in scripthash_status and incorporates
     // confirmed, rooted and unrooted transactions, duplicates, and sort.
     BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
     BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
@@ -231,7 +231,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_address_subscribe__progressive_notify_
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 11_u32 });
 
     const auto notification1 = receive();
     REQUIRE_NO_THROW_TRUE(notification1.at("method").is_string());
@@ -255,7 +255,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_address_subscribe__progressive_notify_
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 12_u32 });
 
     const auto notification2 = receive();
     REQUIRE_NO_THROW_TRUE(notification2.at("method").is_string());
@@ -319,7 +319,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe__initialization__
 {
     BOOST_REQUIRE(handshake(electrum::version::v1_1));
 
-    // This validates the hash accumulator copy in get_scripthash_history() and incorporates
+    // This validates the hash accumulator copy in scripthash_status and incorporates
     // confirmed, rooted and unrooted transactions, duplicates, and sort.
     BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
     BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
@@ -468,7 +468,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe__progressive_noti
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 11_u32 });
 
     const auto notification1 = receive();
     REQUIRE_NO_THROW_TRUE(notification1.at("method").is_string());
@@ -492,7 +492,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe__progressive_noti
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 12_u32 });
 
     const auto notification2 = receive();
     REQUIRE_NO_THROW_TRUE(notification2.at("method").is_string());
@@ -566,6 +566,164 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_unsubscribe__subscribed__tr
     REQUIRE_NO_THROW_TRUE(response2.at("result").as_bool());
 }
 
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_unsubscribe__resubscribe_after_confirmation__current_status)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_4_2));
+
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    const auto hash10 = test::mock_block10.transactions_ptr()->at(1)->hash(false);
+    const auto hash11 = test::mock_block11.transactions_ptr()->at(0)->hash(false);
+
+    const auto request1 = R"({"id":1101,"method":"blockchain.scripthash.subscribe","params":["%1%"]})" "\n";
+    const auto response1 = get((boost_format(request1) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response1.at("result").is_string());
+    BOOST_REQUIRE_EQUAL(response1.at("result").as_string(), encode_base16(sha256_hash
+    (
+        encode_hash(hash10) + ":10:" +
+        encode_hash(hash11) + ":0:"
+    )));
+
+    // The last unsubscriber evicts the shared status.
+    const auto request2 = R"({"id":1102,"method":"blockchain.scripthash.unsubscribe","params":["%1%"]})" "\n";
+    const auto response2 = get((boost_format(request2) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response2.at("result").as_bool());
+
+    // A new subscriber obtains the status as of the current confirmed chain.
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    const auto response3 = get((boost_format(request1) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response3.at("result").is_string());
+    BOOST_REQUIRE_EQUAL(response3.at("result").as_string(), encode_base16(sha256_hash
+    (
+        encode_hash(hash10) + ":10:" +
+        encode_hash(hash11) + ":11:"
+    )));
+}
+
+// blockchain.scripthash.subscribe_many
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__insufficient_version__wrong_version)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_0));
+
+    const auto request = R"({"id":1201,"method":"blockchain.scripthash.subscribe_many","params":[["%1%"]]})" "\n";
+    const auto result = get_error((boost_format(request) % bogus_scripthash).str());
+    BOOST_REQUIRE_EQUAL(result, wrong_version.value());
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__empty__invalid_argument)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+
+    const auto result = get_error(R"({"id":1202,"method":"blockchain.scripthash.subscribe_many","params":[[]]})" "\n");
+    BOOST_REQUIRE_EQUAL(result, invalid_argument.value());
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__invalid_hash__invalid_argument)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+
+    const auto request = R"({"id":1203,"method":"blockchain.scripthash.subscribe_many","params":[["%1%","not_a_hash"]]})" "\n";
+    const auto result = get_error((boost_format(request) % bogus_scripthash).str());
+    BOOST_REQUIRE_EQUAL(result, invalid_argument.value());
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__exceeds_limit__subscription_limit)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+    BOOST_REQUIRE_EQUAL(config_.server.electrum.maximum_subscriptions, 2u);
+
+    const auto request = R"({"id":1204,"method":"blockchain.scripthash.subscribe_many","params":[["%1%","%2%","%1%"]]})" "\n";
+    const auto result = get_error((boost_format(request) % bogus_scripthash % found_scripthash).str());
+    BOOST_REQUIRE_EQUAL(result, code{ server::error::subscription_limit }.value());
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__found_and_bogus__ordered_statuses)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    const auto hash10 = test::mock_block10.transactions_ptr()->at(1)->hash(false);
+    const auto expected = encode_base16(sha256_hash(encode_hash(hash10) + ":10:"));
+
+    const auto request = R"({"id":1205,"method":"blockchain.scripthash.subscribe_many","params":[["%1%","%2%"]]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash % bogus_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_array());
+
+    const auto& statuses = response.at("result").as_array();
+    BOOST_REQUIRE_EQUAL(statuses.size(), 2u);
+    BOOST_REQUIRE(statuses.at(0).is_string());
+    BOOST_REQUIRE(statuses.at(1).is_null());
+    BOOST_REQUIRE_EQUAL(statuses.at(0).as_string(), expected);
+
+    // Subscriptions are shared with the single subscribe method.
+    const auto request2 = R"({"id":1206,"method":"blockchain.scripthash.subscribe","params":["%1%"]})" "\n";
+    const auto response2 = get((boost_format(request2) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response2.at("result").is_string());
+    BOOST_REQUIRE_EQUAL(response2.at("result").as_string(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__duplicate_found__shared_status)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_4_2));
+
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    const auto hash10 = test::mock_block10.transactions_ptr()->at(1)->hash(false);
+    const auto expected = encode_base16(sha256_hash(encode_hash(hash10) + ":10:"));
+
+    const auto request = R"({"id":1207,"method":"blockchain.scripthash.subscribe_many","params":[["%1%","%1%"]]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_array());
+
+    const auto& statuses = response.at("result").as_array();
+    BOOST_REQUIRE_EQUAL(statuses.size(), 2u);
+    BOOST_REQUIRE_EQUAL(statuses.at(0).as_string(), expected);
+    BOOST_REQUIRE_EQUAL(statuses.at(1).as_string(), expected);
+
+    // The duplicate is a single subscription.
+    const auto unsubscribe = R"({"id":1208,"method":"blockchain.scripthash.unsubscribe","params":["%1%"]})" "\n";
+    const auto response1 = get((boost_format(unsubscribe) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response1.at("result").as_bool());
+    const auto response2 = get((boost_format(unsubscribe) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(!response2.at("result").as_bool());
+
+    const auto subscribe = R"({"id":1209,"method":"blockchain.scripthash.subscribe","params":["%1%"]})" "\n";
+    const auto response3 = get((boost_format(subscribe) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response3.at("result").is_string());
+    BOOST_REQUIRE_EQUAL(response3.at("result").as_string(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe_many__later_item_fails__none_subscribed)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_4_2));
+    BOOST_REQUIRE_EQUAL(config_.server.electrum.maximum_history, 5u);
+
+    // Six unconfirmed payments exceed the maximum history of the second item.
+    const chain::script heavy{ chain::script::to_pay_key_hash_pattern({ 0x43 }) };
+    for (uint32_t sequence = 0; sequence < 6u; ++sequence)
+    {
+        BOOST_REQUIRE(query_.set(chain::transaction
+        {
+            0x01,
+            chain::inputs{ { chain::point{}, chain::script{}, chain::witness{}, sequence } },
+            chain::outputs{ { 0x01, heavy } },
+            0x00
+        }));
+    }
+
+    const auto heavy_scripthash = encode_hash(sha256_hash(heavy.to_data(false)));
+    const auto request = R"({"id":1210,"method":"blockchain.scripthash.subscribe_many","params":[["%1%","%2%"]]})" "\n";
+    BOOST_REQUIRE(get_error((boost_format(request) % found_scripthash % heavy_scripthash).str()) > 0);
+
+    // The first item was not left subscribed by the failed request.
+    const auto unsubscribe = R"({"id":1211,"method":"blockchain.scripthash.unsubscribe","params":["%1%"]})" "\n";
+    const auto response = get((boost_format(unsubscribe) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(!response.at("result").as_bool());
+}
+
 // blockchain.scriptpubkey.subscribe
 
 BOOST_AUTO_TEST_CASE(electrum__blockchain_scriptpubkey_subscribe__insufficient_version__wrong_version)
@@ -615,7 +773,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scriptpubkey_subscribe__initialization
 {
     BOOST_REQUIRE(handshake(electrum::version::v1_7));
 
-    // This validates the hash accumulator copy in get_scripthash_history() and incorporates
+    // This validates the hash accumulator copy in scripthash_status and incorporates
     // confirmed, rooted and unrooted transactions, duplicates, and sort.
     BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
     BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
@@ -764,7 +922,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scriptpubkey_subscribe__progressive_no
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 11_u32 });
 
     const auto notification1 = receive();
     REQUIRE_NO_THROW_TRUE(notification1.at("method").is_string());
@@ -788,7 +946,7 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scriptpubkey_subscribe__progressive_no
     ));
 
     // Trigger node chaser event to electrum event subscriber.
-    notify(node::chase::organized);
+    notify(node::chase::organized, { 12_u32 });
 
     const auto notification2 = receive();
     REQUIRE_NO_THROW_TRUE(notification2.at("method").is_string());
@@ -906,4 +1064,54 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe__reorganized_noti
     BOOST_REQUIRE_EQUAL(params.at(1).as_string(), expected_confirmed);
 }
 
+BOOST_AUTO_TEST_CASE(electrum__blockchain_scripthash_subscribe__reorganized_above_checkpoint__status_recomputed_clean)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_1));
+
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block12, database::context{ 0, 12, 0 }, false, false));
+    const auto hash10 = test::mock_block10.transactions_ptr()->at(1)->hash(false);
+    const auto hash11 = test::mock_block11.transactions_ptr()->at(0)->hash(false);
+    const auto hash12 = test::mock_block12.transactions_ptr()->at(0)->hash(false);
+
+    // Subscription checkpoints the confirmed midstate at block 10.
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    const auto request = R"({"id":1101,"method":"blockchain.scripthash.subscribe","params":["%1%"]})" "\n";
+    const auto response = get((boost_format(request) % found_scripthash).str());
+    REQUIRE_NO_THROW_TRUE(response.at("result").is_string());
+
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block12.hash()), true));
+    const auto expected_confirmed = encode_base16(sha256_hash
+    (
+        encode_hash(hash10) + ":10:" +
+        encode_hash(hash11) + ":11:" +
+        encode_hash(hash12) + ":12:"
+    ));
+
+    // Organized folds blocks 11 and 12 into a later checkpoint.
+    const auto top = query_.to_header(test::mock_block12.hash());
+    notify(node::chase::organized, { top.value });
+    const auto notification1 = receive();
+    REQUIRE_NO_THROW_TRUE(notification1.at("params").is_array());
+    BOOST_REQUIRE_EQUAL(notification1.at("params").as_array().at(1).as_string(), expected_confirmed);
+
+    // Branch point at block 11 discards the later checkpoint and refolds from
+    // the earlier one, which must reproduce the same status.
+    const auto branch = query_.to_header(test::mock_block11.hash());
+    notify(node::chase::reorganized, { branch.value });
+    notify(node::chase::organized);
+
+    const auto notification2 = receive();
+    REQUIRE_NO_THROW_TRUE(notification2.at("method").is_string());
+    REQUIRE_NO_THROW_TRUE(notification2.at("params").is_array());
+    BOOST_REQUIRE_EQUAL(notification2.at("method").as_string(), "blockchain.scripthash.subscribe");
+
+    const auto& params = notification2.at("params").as_array();
+    BOOST_REQUIRE_EQUAL(params.size(), 2u);
+    BOOST_REQUIRE(params.at(1).is_string());
+    BOOST_REQUIRE_EQUAL(params.at(1).as_string(), expected_confirmed);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -146,6 +146,17 @@ BOOST_AUTO_TEST_CASE(electrum__blockchain_transaction_broadcast_package__invalid
     BOOST_REQUIRE_EQUAL(response.at("error").as_object().at("code").as_int64(), invalid_argument.value());
 }
 
+BOOST_AUTO_TEST_CASE(electrum__blockchain_transaction_broadcast_package__duplicate_transaction__invalid_argument)
+{
+    BOOST_REQUIRE(handshake(electrum::version::v1_6));
+
+    const auto tx_text = encode_base16(test::block1.transactions_ptr()->front()->to_data(true));
+    constexpr auto request = R"({"id":73,"method":"blockchain.transaction.broadcast_package","params":[["%1%","%1%"]]})" "\n";
+    const auto response = get((boost_format(request) % tx_text).str());
+    REQUIRE_NO_THROW_TRUE(response.at("error").as_object().at("code").is_int64());
+    BOOST_REQUIRE_EQUAL(response.at("error").as_object().at("code").as_int64(), invalid_argument.value());
+}
+
 BOOST_AUTO_TEST_CASE(electrum__blockchain_transaction_broadcast_package__two_transactions__unconfirmable_transaction)
 {
     BOOST_REQUIRE(handshake(electrum::version::v1_6));
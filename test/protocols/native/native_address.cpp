@@ -21,4 +21,49 @@
 
 BOOST_FIXTURE_TEST_SUITE(native_tests, native_ten_block_setup_fixture)
 
+using namespace system;
+
+// subscribe
+
+BOOST_AUTO_TEST_CASE(native__ws_address_subscribe__stop__empty)
+{
+    BOOST_REQUIRE(!ws_upgrade());
+
+    const auto hash = encode_hash(one_hash);
+    const auto response = ws_get_text("/v1/address/" + hash + "/subscribe?stop=true");
+    BOOST_REQUIRE(response.empty());
+}
+
+BOOST_AUTO_TEST_CASE(native__ws_address_subscribe__confirmed_payments__changed_outpoints_notified)
+{
+    BOOST_REQUIRE(!ws_upgrade());
+
+    // mock_block10 and mock_block11 each pay to the script.
+    const auto script = chain::script::to_pay_key_hash_pattern({ 0x02 });
+    const auto key = script.hash();
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    const auto target = "/v1/address/" + encode_hash(key) + "/subscribe?format=data";
+    BOOST_REQUIRE(!ws_get_data(target).empty());
+
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    notify(node::chase::block, node::header_t{ 11 });
+
+    // The scripthash followed by the two outputs of mock_block11 paying to it.
+    const auto& tx = *test::mock_block11.transactions_ptr()->front();
+    database::outpoints expected
+    {
+        { chain::point{ tx.hash(false), 0 }, 0x10 },
+        { chain::point{ tx.hash(false), 1 }, 0x11 }
+    };
+
+    data_chunk body{ key.begin(), key.end() };
+    for (const auto& outpoint: expected)
+        extend(body, outpoint.to_data());
+
+    BOOST_REQUIRE_EQUAL(ws_receive(), body);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
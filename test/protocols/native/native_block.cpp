@@ -181,4 +181,84 @@ BOOST_AUTO_TEST_CASE(native__ws_top_subscribe__reorganized__emits_top_height)
     BOOST_REQUIRE_EQUAL(to_string(ws_receive()), "0b");
 }
 
+// block (http, response cache)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(native__block__text_repeated__cached_expected)
+{
+    const auto hash = encode_hash(test::block1.hash());
+    const auto by_height = get_text("/v1/block/height/1?format=text");
+    BOOST_REQUIRE(!by_height.empty());
+    BOOST_REQUIRE_EQUAL(get_text("/v1/block/height/1?format=text"), by_height);
+    BOOST_REQUIRE_EQUAL(get_text("/v1/block/hash/" + hash + "?format=text"),
+        by_height);
+}
+
+BOOST_AUTO_TEST_CASE(native__block__data_and_text__cached_distinct_media)
+{
+    const auto text = get_text("/v1/block/height/2?format=text");
+    const auto data = get_data("/v1/block/height/2?format=data");
+    BOOST_REQUIRE_EQUAL(encode_base16(data), text);
+    BOOST_REQUIRE_EQUAL(encode_base16(get_data("/v1/block/height/2?format=data")),
+        text);
+}
+
+BOOST_AUTO_TEST_CASE(native__block_header__json_repeated__cached_expected)
+{
+    const auto first = get_json("/v1/block/height/3/header?format=json");
+    BOOST_REQUIRE(first.is_object());
+    BOOST_REQUIRE_EQUAL(first.at("height").as_int64(), 3);
+    BOOST_REQUIRE_EQUAL(get_json("/v1/block/height/3/header?format=json"),
+        first);
+}
+
+// block (http, conditional)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(native__block__if_none_match_wildcard_unknown__not_found)
+{
+    const auto hash = encode_hash(one_hash);
+    const auto status = get_status("/v1/block/hash/" + hash + "?format=text",
+        http::field::if_none_match, "*");
+    BOOST_REQUIRE(status == http::status::not_found);
+}
+
+BOOST_AUTO_TEST_CASE(native__block__if_none_match_wildcard_shallow__ok)
+{
+    const auto hash = encode_hash(test::block1.hash());
+    const auto status = get_status("/v1/block/hash/" + hash + "?format=text",
+        http::field::if_none_match, "*");
+    BOOST_REQUIRE(status == http::status::ok);
+}
+
+// block (http, range)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(native__block__range_header__header_bytes)
+{
+    const auto expected = test::block1.header().to_data();
+    const auto part = get_partial("/v1/block/height/1?format=data",
+        "bytes=0-79");
+    BOOST_REQUIRE_EQUAL(part, std::string(expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE(native__block__range_transactions__transaction_bytes)
+{
+    // The header (80) and transaction count (1) precede the coinbase.
+    const auto expected = test::block1.transactions_ptr()->front()->to_data(
+        true);
+    const auto part = get_partial("/v1/block/height/1?format=data",
+        "bytes=81-");
+    BOOST_REQUIRE_EQUAL(part, std::string(expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE(native__block__range_cached__expected)
+{
+    const auto full = get_data("/v1/block/height/2?format=data");
+    const auto part = get_partial("/v1/block/height/2?format=data",
+        "bytes=-10");
+    BOOST_REQUIRE_EQUAL(part, std::string(std::prev(full.end(), 10),
+        full.end()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -21,4 +21,36 @@
 
 BOOST_FIXTURE_TEST_SUITE(native_tests, native_ten_block_setup_fixture)
 
+using namespace system;
+
+// subscribe
+
+BOOST_AUTO_TEST_CASE(native__ws_output_subscribe__stop__empty)
+{
+    BOOST_REQUIRE(!ws_upgrade());
+
+    const auto hash = encode_hash(test::block3.transactions_ptr()->front()->hash(false));
+    const auto response = ws_get_text("/v1/output/" + hash + "/0/subscribe?stop=true");
+    BOOST_REQUIRE(response.empty());
+}
+
+BOOST_AUTO_TEST_CASE(native__ws_output_subscribe__confirmed_spender__notified)
+{
+    BOOST_REQUIRE(!ws_upgrade());
+
+    const auto& tx = *test::block3.transactions_ptr()->front();
+    const auto target = "/v1/output/" + encode_hash(tx.hash(false)) + "/0/subscribe?format=data";
+    BOOST_REQUIRE_EQUAL(ws_get_data(target), tx.outputs_ptr()->front()->to_data());
+
+    // mock_block11 spends block3:0.
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    notify(node::chase::block, node::header_t{ 11 });
+
+    const chain::point spender{ test::mock_block11.transactions_ptr()->front()->hash(false), 0 };
+    BOOST_REQUIRE_EQUAL(ws_receive(), spender.to_data());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -144,6 +144,22 @@ http::status native_setup_fixture::get_status(std::string_view target)
     return response.result();
 }
 
+http::status native_setup_fixture::get_status(std::string_view target,
+    http::field field, std::string_view value)
+{
+    auto request = create_request(target);
+    request.set(field, value);
+    http::write(socket_, request);
+
+    flat_buffer buffer{};
+    network::boost_code ec{};
+    http::response<http::string_body> response{};
+    http::read(socket_, buffer, response, ec);
+    BOOST_CHECK_MESSAGE(!ec, ec.message());
+
+    return response.result();
+}
+
 std::string native_setup_fixture::get_text(std::string_view target)
 {
     http::write(socket_, create_request(target));
@@ -158,6 +174,23 @@ std::string native_setup_fixture::get_text(std::string_view target)
     return response.body();
 }
 
+std::string native_setup_fixture::get_partial(std::string_view target,
+    std::string_view range)
+{
+    auto request = create_request(target);
+    request.set(http::field::range, range);
+    http::write(socket_, request);
+
+    flat_buffer buffer{};
+    network::boost_code ec{};
+    http::response<http::string_body> response{};
+    http::read(socket_, buffer, response, ec);
+    BOOST_CHECK_MESSAGE(!ec, ec.message());
+    BOOST_CHECK_EQUAL(response.result(), http::status::partial_content);
+
+    return response.body();
+}
+
 system::data_chunk native_setup_fixture::get_data(std::string_view target)
 {
     http::write(socket_, create_request(target));
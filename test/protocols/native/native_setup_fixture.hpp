@@ -37,8 +37,11 @@ struct native_setup_fixture
 
     bool expect_dropped(std::string_view target);
     status get_status(std::string_view target);
+    status get_status(std::string_view target,
+        boost::beast::http::field field, std::string_view value);
 
     std::string get_text(std::string_view target);
+    std::string get_partial(std::string_view target, std::string_view range);
     system::data_chunk get_data(std::string_view target);
     boost::json::value get_json(std::string_view target);
 
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "services_setup_fixture.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(header_merkle_tests, services_setup_fixture)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(header_merkle__get_root_and_proof__confirmed__expected)
+{
+    header_merkle instance{};
+    hashes proof{};
+    hash_digest root{};
+    BOOST_REQUIRE(!instance.get_root_and_proof(root, proof, query_, 1, 7));
+    BOOST_REQUIRE_EQUAL(root, test::root07);
+    BOOST_REQUIRE_EQUAL(proof.size(), 3u);
+    BOOST_REQUIRE_EQUAL(proof.at(0), test::block0_hash);
+    BOOST_REQUIRE_EQUAL(proof.at(1), test::root23);
+    BOOST_REQUIRE_EQUAL(proof.at(2), test::root47);
+    BOOST_REQUIRE_EQUAL(instance.size(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(header_merkle__get_root_and_proof__prefix__not_extended)
+{
+    header_merkle instance{};
+    hashes proof{};
+    hash_digest root{};
+    BOOST_REQUIRE(!instance.get_root_and_proof(root, proof, query_, 0, 8));
+    BOOST_REQUIRE_EQUAL(root, test::root08);
+    BOOST_REQUIRE_EQUAL(instance.size(), 9u);
+
+    // A shorter checkpoint is proven from the accumulated leaves.
+    BOOST_REQUIRE(!instance.get_root_and_proof(root, proof, query_, 0, 1));
+    BOOST_REQUIRE_EQUAL(root, test::root01);
+    BOOST_REQUIRE_EQUAL(proof.size(), 1u);
+    BOOST_REQUIRE_EQUAL(proof.front(), test::block1_hash);
+    BOOST_REQUIRE_EQUAL(instance.size(), 9u);
+}
+
+BOOST_AUTO_TEST_CASE(header_merkle__get_root_and_proof__above_top__not_found)
+{
+    header_merkle instance{};
+    hashes proof{};
+    hash_digest root{};
+    BOOST_REQUIRE(instance.get_root_and_proof(root, proof, query_, 0, 10) == error::not_found);
+    BOOST_REQUIRE(instance.get_root_and_proof(root, proof, query_, 2, 1) == error::target_overflow);
+}
+
+BOOST_AUTO_TEST_CASE(header_merkle__reorganized__branch_point__truncated)
+{
+    header_merkle instance{};
+    hashes proof{};
+    hash_digest root{};
+    BOOST_REQUIRE(!instance.get_root_and_proof(root, proof, query_, 0, 8));
+    BOOST_REQUIRE_EQUAL(instance.size(), 9u);
+
+    pop_confirmed(3);
+    instance.reorganized(3);
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE(!instance.get_root_and_proof(root, proof, query_, 0, 3));
+    BOOST_REQUIRE_EQUAL(root, test::root03);
+    BOOST_REQUIRE(instance.get_root_and_proof(root, proof, query_, 0, 8) == error::not_found);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
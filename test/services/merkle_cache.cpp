@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "services_setup_fixture.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(merkle_cache_tests, services_setup_fixture)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(merkle_cache__get__confirmed_block__cached_tree)
+{
+    merkle_cache instance{};
+    const auto link = query_.to_header(test::block1_hash);
+    const auto levels = instance.get(query_, link);
+    BOOST_REQUIRE(levels);
+    BOOST_REQUIRE_EQUAL(levels->back().front(), test::block1.header().merkle_root());
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    // A hit returns the cached tree.
+    BOOST_REQUIRE(instance.get(query_, link) == levels);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_cache__get__missing_block__null)
+{
+    merkle_cache instance{};
+    BOOST_REQUIRE(!instance.get(query_, database::header_link::terminal));
+    BOOST_REQUIRE(!instance.get(query_, query_.to_header(null_hash)));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_cache__get__over_limit__least_recent_displaced)
+{
+    merkle_cache instance{ 2 };
+    const auto link1 = query_.to_header(test::block1_hash);
+    const auto link2 = query_.to_header(test::block2_hash);
+    const auto link3 = query_.to_header(test::block3_hash);
+    const auto levels1 = instance.get(query_, link1);
+    const auto levels2 = instance.get(query_, link2);
+
+    // Block1 is used most recently, so block2 is displaced by block3.
+    BOOST_REQUIRE(instance.get(query_, link1) == levels1);
+    BOOST_REQUIRE(instance.get(query_, link3));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.get(query_, link1) == levels1);
+    BOOST_REQUIRE(instance.get(query_, link2) != levels2);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_cache__reorganized__branch_point__evicts_above)
+{
+    merkle_cache instance{};
+    const auto link2 = query_.to_header(test::block2_hash);
+    const auto levels2 = instance.get(query_, link2);
+    BOOST_REQUIRE(instance.get(query_, query_.to_header(test::block3_hash)));
+    BOOST_REQUIRE(instance.get(query_, query_.to_header(test::block4_hash)));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+
+    instance.reorganized(2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.get(query_, link2) == levels2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "services_setup_fixture.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(response_cache_tests, services_setup_fixture)
+
+using namespace system;
+
+constexpr auto megabyte = 1024_size * 1024_size;
+
+BOOST_AUTO_TEST_CASE(response_cache__key__parts__delimited)
+{
+    BOOST_REQUIRE_EQUAL(response_cache::key("native", "block", "42", "json"), "native/block/42/json");
+}
+
+BOOST_AUTO_TEST_CASE(response_cache__put__confirmed_block__get_cached)
+{
+    response_cache instance{ 1 };
+    const auto link = query_.to_header(test::block1_hash);
+    const auto put = instance.put(query_, "key", link, "response");
+    BOOST_REQUIRE_EQUAL(*put, "response");
+    BOOST_REQUIRE_EQUAL(instance.size(), 11u);
+
+    const auto got = instance.get(query_, "key");
+    BOOST_REQUIRE(got == put);
+    BOOST_REQUIRE(!instance.get(query_, "other"));
+}
+
+BOOST_AUTO_TEST_CASE(response_cache__put__zero_budget__not_cached)
+{
+    response_cache instance{ 0 };
+    const auto link = query_.to_header(test::block1_hash);
+    BOOST_REQUIRE_EQUAL(*instance.put(query_, "key", link, "response"), "response");
+    BOOST_REQUIRE(!instance.get(query_, "key"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(response_cache__put__over_budget__least_recent_displaced)
+{
+    response_cache instance{ 1 };
+    const auto link1 = query_.to_header(test::block1_hash);
+    const auto link2 = query_.to_header(test::block2_hash);
+    const auto half = to_half(megabyte) - 8u;
+    BOOST_REQUIRE(instance.put(query_, "1", link1, std::string(half, 'a')));
+    BOOST_REQUIRE(instance.put(query_, "2", link2, std::string(half, 'b')));
+    BOOST_REQUIRE(instance.get(query_, "1"));
+    BOOST_REQUIRE(instance.get(query_, "2"));
+
+    // Displaces the least recently used ("1") to fit within the budget.
+    BOOST_REQUIRE(instance.put(query_, "3", link1, std::string(32, 'c')));
+    BOOST_REQUIRE(!instance.get(query_, "1"));
+    BOOST_REQUIRE(instance.get(query_, "2"));
+    BOOST_REQUIRE(instance.get(query_, "3"));
+    BOOST_REQUIRE(instance.size() <= megabyte);
+}
+
+BOOST_AUTO_TEST_CASE(response_cache__put__exceeds_budget__not_cached)
+{
+    response_cache instance{ 1 };
+    const auto link = query_.to_header(test::block1_hash);
+    BOOST_REQUIRE(instance.put(query_, "key", link, std::string(megabyte, 'a')));
+    BOOST_REQUIRE(!instance.get(query_, "key"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(response_cache__reorganized__branch_point__evicts_above)
+{
+    response_cache instance{ 1 };
+    const auto link2 = query_.to_header(test::block2_hash);
+    const auto link5 = query_.to_header(test::block5_hash);
+    BOOST_REQUIRE(instance.put(query_, "2", link2, "two"));
+    BOOST_REQUIRE(instance.put(query_, "5", link5, "five"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 9u);
+
+    // A response of a block no longer confirmed is not served.
+    pop_confirmed(3);
+    BOOST_REQUIRE(!instance.get(query_, "5"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 9u);
+
+    instance.reorganized(3);
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE(instance.get(query_, "2"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
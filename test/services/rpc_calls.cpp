@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(rpc_calls_tests)
+
+BOOST_AUTO_TEST_CASE(rpc_calls__begin__below_maximum__registered_in_order)
+{
+    rpc_calls instance{};
+    const auto first = instance.begin("getblock");
+    const auto second = instance.begin("gettxoutproof");
+    BOOST_REQUIRE(!is_zero(first));
+    BOOST_REQUIRE(!is_zero(second));
+    BOOST_REQUIRE_NE(first, second);
+
+    const auto active = instance.active();
+    BOOST_REQUIRE_EQUAL(active.size(), 2u);
+    BOOST_REQUIRE_EQUAL(active.front().method, "getblock");
+    BOOST_REQUIRE_EQUAL(active.back().method, "gettxoutproof");
+}
+
+BOOST_AUTO_TEST_CASE(rpc_calls__begin__maximum__zero)
+{
+    rpc_calls instance{};
+    for (size_t call = 0; call < rpc_calls::maximum_calls; ++call)
+    {
+        BOOST_REQUIRE(!is_zero(instance.begin("getblockstats")));
+    }
+
+    BOOST_REQUIRE(is_zero(instance.begin("getblockstats")));
+    BOOST_REQUIRE_EQUAL(instance.size(), rpc_calls::maximum_calls);
+}
+
+BOOST_AUTO_TEST_CASE(rpc_calls__end__registered__removed_and_slot_released)
+{
+    rpc_calls instance{};
+    uint64_t last{};
+    for (size_t call = 0; call < rpc_calls::maximum_calls; ++call)
+        last = instance.begin("getchaintxstats");
+
+    instance.end(last);
+    instance.end(0);
+    BOOST_REQUIRE_EQUAL(instance.size(), sub1(rpc_calls::maximum_calls));
+    BOOST_REQUIRE(!is_zero(instance.begin("getchaintxstats")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "../test.hpp"
+#include "services_setup_fixture.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(scripthash_status_tests, services_setup_fixture)
+
+using namespace system;
+
+// Mock blocks 10, 11 and 12 each pay to this script.
+static const auto key = chain::script::to_pay_key_hash_pattern({ 0x02 }).hash();
+static const database::header_link terminal{};
+constexpr auto limit = 100_size;
+constexpr auto turbo = false;
+
+static hash_digest tx_hash(const chain::block& block, size_t position) NOEXCEPT
+{
+    return block.transactions_ptr()->at(position)->hash(false);
+}
+
+static hash_digest confirmed10() NOEXCEPT
+{
+    return sha256_hash
+    (
+        encode_hash(tx_hash(test::mock_block10, 1)) + ":10:"
+    );
+}
+
+static hash_digest unconfirmed11() NOEXCEPT
+{
+    return sha256_hash
+    (
+        encode_hash(tx_hash(test::mock_block10, 1)) + ":10:" +
+        encode_hash(tx_hash(test::mock_block11, 0)) + ":0:"
+    );
+}
+
+static hash_digest confirmed11() NOEXCEPT
+{
+    return sha256_hash
+    (
+        encode_hash(tx_hash(test::mock_block10, 1)) + ":10:" +
+        encode_hash(tx_hash(test::mock_block11, 0)) + ":11:"
+    );
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__subscribe__no_history__null_hash)
+{
+    const std::atomic_bool cancel{};
+    scripthash_status instance{};
+    hash_digest out{ 0x42 };
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, null_hash);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__reorganized__checkpoint_without_later_history__restored)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+
+    // There is no history above the restored checkpoint.
+    instance.reorganized(10);
+    out = {};
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__reorganized__checkpoint_with_later_history__refolded)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed11());
+
+    // Popped block 11 remains stored, so its (rooted) tx is unconfirmed.
+    pop_confirmed(10);
+    instance.reorganized(10);
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, unconfirmed11());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__reorganized__below_checkpoints__rewound_to_initial)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+
+    // The rewound status is that of a new subscription.
+    pop_confirmed(9);
+    instance.reorganized(9);
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+
+    scripthash_status fresh{};
+    hash_digest expected{};
+    BOOST_REQUIRE(!fresh.subscribe(expected, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, expected);
+
+    // Refolding from the initial state is not poisoned by the prior flush.
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__reset__subscribed__refolded)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, unconfirmed11());
+
+    instance.reset();
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, unconfirmed11());
+
+    // Checkpoints are cleared, so a later rewind is also to the initial state.
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block11.hash()), true));
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed11());
+
+    instance.reset();
+    BOOST_REQUIRE(!instance.status(out, query_, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed11());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__status__unconfirmed_removed__confirmed_status)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::mock_block11, database::context{ 0, 11, 0 }, false, false));
+    BOOST_REQUIRE(query_.push_confirmed(query_.to_header(test::mock_block10.hash()), true));
+
+    // A store without the block 11 tx, as if evicted from the pool.
+    database::settings settings{ config_.database };
+    settings.path = TEST_DIRECTORY + "/evicted";
+    test::store_t store{ settings };
+    test::query_t evicted{ store };
+    auto ec = store.create([](auto, auto) {});
+    BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+    BOOST_REQUIRE(test::setup_ten_block_store(evicted));
+    BOOST_REQUIRE(evicted.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+    BOOST_REQUIRE(evicted.push_confirmed(evicted.to_header(test::mock_block10.hash()), true));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, unconfirmed11());
+
+    // There is no history above the cursor, and the status is not stale.
+    BOOST_REQUIRE(!instance.status(out, evicted, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, confirmed10());
+
+    ec = store.close([](auto, auto) {});
+    BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__status__unconfirmed_only_removed__null_hash)
+{
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(query_.set(test::mock_block10, database::context{ 0, 10, 0 }, false, false));
+
+    // A store without the block 10 tx, as if evicted from the pool.
+    database::settings settings{ config_.database };
+    settings.path = TEST_DIRECTORY + "/evicted";
+    test::store_t store{ settings };
+    test::query_t evicted{ store };
+    auto ec = store.create([](auto, auto) {});
+    BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+    BOOST_REQUIRE(test::setup_ten_block_store(evicted));
+
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE_NE(out, null_hash);
+
+    // Nothing has been folded, so no history is the null status.
+    BOOST_REQUIRE(!instance.status(out, evicted, cancel, key, terminal, limit, turbo));
+    BOOST_REQUIRE_EQUAL(out, null_hash);
+
+    ec = store.close([](auto, auto) {});
+    BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+}
+
+BOOST_AUTO_TEST_CASE(scripthash_status__unsubscribe__last_subscriber__evicted)
+{
+    const std::atomic_bool cancel{};
+    scripthash_status instance{};
+    hash_digest out{};
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    BOOST_REQUIRE(!instance.subscribe(out, query_, cancel, key, limit, turbo));
+    instance.unsubscribe(key);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    instance.unsubscribe(key);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.status(out, query_, cancel, key, terminal, limit, turbo) == error::not_found);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "services_setup_fixture.hpp"
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+services_setup_fixture::services_setup_fixture()
+  : config_
+    {
+      system::chain::selection::mainnet,
+      test::web_pages,
+      test::web_pages
+    },
+    store_
+    {
+        [&]() NOEXCEPT -> const database::settings&
+        {
+            config_.database.path = TEST_DIRECTORY;
+            return config_.database;
+        }()
+    },
+    query_{ store_ }
+{
+    test::clear(test::directory);
+
+    const auto ec = store_.create([](auto, auto) {});
+    BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+    BOOST_REQUIRE(test::setup_ten_block_store(query_));
+}
+
+services_setup_fixture::~services_setup_fixture()
+{
+    const auto ec = store_.close([](auto, auto){});
+    BOOST_WARN_MESSAGE(!ec, ec.message());
+    test::clear(test::directory);
+}
+
+void services_setup_fixture::pop_confirmed(size_t height)
+{
+    while (query_.get_top_confirmed() > height)
+    {
+        BOOST_REQUIRE(query_.pop_confirmed());
+    }
+}
+
+BC_POP_WARNING()
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_TEST_SERVICES_SERVICES_SETUP_FIXTURE
+#define LIBBITCOIN_SERVER_TEST_SERVICES_SERVICES_SETUP_FIXTURE
+
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+
+/// A ten block confirmed store, for services that read the store.
+struct services_setup_fixture
+{
+    DELETE_COPY_MOVE(services_setup_fixture);
+
+    services_setup_fixture();
+    ~services_setup_fixture();
+
+    /// Pop confirmed blocks down to the height, as a reorganization.
+    void pop_confirmed(size_t height);
+
+protected:
+    configuration config_;
+    test::store_t store_;
+    test::query_t query_;
+};
+
+#endif
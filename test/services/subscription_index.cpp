@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <boost/mpl/list.hpp>
+
+BOOST_AUTO_TEST_SUITE(subscription_index_tests)
+
+using namespace system;
+using indexes = boost::mpl::list<scripthash_index, outpoint_index>;
+
+// A distinct key of each index type for each value.
+template <typename Key>
+static Key key(size_t value) NOEXCEPT;
+
+template <>
+hash_digest key<hash_digest>(size_t value) NOEXCEPT
+{
+    return hash_digest{ possible_narrow_cast<uint8_t>(value) };
+}
+
+template <>
+chain::point key<chain::point>(size_t value) NOEXCEPT
+{
+    return { one_hash, possible_narrow_cast<uint32_t>(value) };
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(subscription_index__subscribe__distinct_keys__expected_size, Index, indexes)
+{
+    using key_type = typename Index::key_type;
+    Index instance{};
+    instance.subscribe(1, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(2));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(subscription_index__unsubscribe__channel__removes_all_channel_keys, Index, indexes)
+{
+    using key_type = typename Index::key_type;
+    Index instance{};
+    instance.subscribe(1, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(2));
+    instance.unsubscribe(2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    instance.unsubscribe(1, key<key_type>(1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(subscription_index__touched__intersecting__only_channel_keys, Index, indexes)
+{
+    using key_type = typename Index::key_type;
+    Index instance{};
+    instance.subscribe(1, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(1));
+    instance.subscribe(2, key<key_type>(2));
+    instance.subscribe(3, key<key_type>(3));
+
+    const typename Index::key_set touched{ key<key_type>(1), key<key_type>(2) };
+    typename Index::keys keys1{};
+    typename Index::keys keys2{};
+    typename Index::keys keys3{};
+    instance.touched(keys1, 42, touched, 1);
+    instance.touched(keys2, 42, touched, 2);
+    instance.touched(keys3, 42, touched, 3);
+    BOOST_REQUIRE_EQUAL(keys1.size(), 1u);
+    BOOST_REQUIRE(keys1.front() == key<key_type>(1));
+    BOOST_REQUIRE_EQUAL(keys2.size(), 2u);
+    BOOST_REQUIRE(keys3.empty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(subscription_index__touched__cached_block__ignores_set, Index, indexes)
+{
+    using key_type = typename Index::key_type;
+    Index instance{};
+    instance.subscribe(1, key<key_type>(1));
+
+    // The block intersection is computed once, by its first request.
+    typename Index::keys keys1{};
+    typename Index::keys keys2{};
+    instance.touched(keys1, 42, { key<key_type>(1) }, 1);
+    instance.touched(keys2, 42, {}, 1);
+    BOOST_REQUIRE_EQUAL(keys1.size(), 1u);
+    BOOST_REQUIRE_EQUAL(keys2.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(subscription_index__touched__other_block__intersected, Index, indexes)
+{
+    using key_type = typename Index::key_type;
+    Index instance{};
+    instance.subscribe(1, key<key_type>(1));
+
+    typename Index::keys keys1{};
+    typename Index::keys keys2{};
+    instance.touched(keys1, 42, { key<key_type>(1) }, 1);
+    instance.touched(keys2, 43, { key<key_type>(2) }, 1);
+    BOOST_REQUIRE_EQUAL(keys1.size(), 1u);
+    BOOST_REQUIRE(keys2.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
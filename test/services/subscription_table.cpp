@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(subscription_table_tests)
+
+// Collide all keys into few home slots, to exercise probe runs.
+struct collide
+{
+    size_t operator()(size_t key) const NOEXCEPT
+    {
+        return key % 3u;
+    }
+};
+
+using table = subscription_table<size_t, std::string, collide>;
+
+BOOST_AUTO_TEST_CASE(subscription_table__construct__default__empty)
+{
+    const table instance{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.memory(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+    BOOST_REQUIRE(!instance.contains(42));
+}
+
+BOOST_AUTO_TEST_CASE(subscription_table__try_emplace__duplicate__not_replaced)
+{
+    table instance{};
+    const auto first = instance.try_emplace(42, "a");
+    BOOST_REQUIRE(first.second);
+    BOOST_REQUIRE_EQUAL(first.first->second, "a");
+
+    const auto second = instance.try_emplace(42, "b");
+    BOOST_REQUIRE(!second.second);
+    BOOST_REQUIRE_EQUAL(second.first->second, "a");
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(subscription_table__try_emplace__beyond_load__grown_and_found)
+{
+    table instance{};
+    for (size_t key{}; key < 100u; ++key)
+    {
+        BOOST_REQUIRE(instance.try_emplace(key, std::to_string(key)).second);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 256u);
+    BOOST_REQUIRE_GE(instance.memory(), 256u * sizeof(table::value_type));
+
+    for (size_t key{}; key < 100u; ++key)
+    {
+        const auto it = instance.find(key);
+        BOOST_REQUIRE(it != instance.end());
+        BOOST_REQUIRE_EQUAL(it->second, std::to_string(key));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(subscription_table__erase__within_probe_run__others_found)
+{
+    table instance{};
+    for (size_t key{}; key < 12u; ++key)
+    {
+        instance.try_emplace(key, std::to_string(key));
+    }
+
+    // Every third key shares a home slot, removal must not break the run.
+    for (size_t key{}; key < 12u; key += 3u)
+    {
+        BOOST_REQUIRE_EQUAL(instance.erase(key), 1u);
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.erase(0u), 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 8u);
+    for (size_t key{}; key < 12u; ++key)
+    {
+        BOOST_REQUIRE_EQUAL(instance.contains(key), !is_zero(key % 3u));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(subscription_table__iterate__populated__each_entry_once)
+{
+    table instance{};
+    for (size_t key{}; key < 20u; ++key)
+    {
+        instance.try_emplace(key, std::to_string(key));
+    }
+
+    size_t count{};
+    size_t total{};
+    for (const auto& [key, value]: instance)
+    {
+        BOOST_REQUIRE_EQUAL(value, std::to_string(key));
+        total += key;
+        ++count;
+    }
+
+    BOOST_REQUIRE_EQUAL(count, 20u);
+    BOOST_REQUIRE_EQUAL(total, 190u);
+}
+
+BOOST_AUTO_TEST_CASE(subscription_table__release__populated__storage_freed)
+{
+    table instance{};
+    instance.try_emplace(1, "a");
+    instance.try_emplace(2, "b");
+    instance.release();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.memory(), 0u);
+    BOOST_REQUIRE(!instance.contains(1));
+    BOOST_REQUIRE(instance.try_emplace(1, "c").second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
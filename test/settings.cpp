@@ -51,6 +51,14 @@ BOOST_AUTO_TEST_CASE(settings__log__default_context__expected)
 
 // [server]
 
+BOOST_AUTO_TEST_CASE(server__settings__defaults__expected)
+{
+    const server::settings::embedded_pages admin{};
+    const server::settings::embedded_pages native{};
+    const server::settings instance{ selection::none, native, admin };
+    BOOST_REQUIRE_EQUAL(instance.response_cache, 64u);
+}
+
 BOOST_AUTO_TEST_CASE(server__html_server__defaults__expected)
 {
     const auto undefined = server::settings::embedded_pages{};
@@ -173,6 +181,7 @@ BOOST_AUTO_TEST_CASE(server__native_server__defaults__expected)
     BOOST_REQUIRE(server.path.empty());
     BOOST_REQUIRE(server.websocket);
     BOOST_REQUIRE_EQUAL(server.default_, "index.html");
+    BOOST_REQUIRE_EQUAL(server.maximum_subscriptions, 1'000'000u);
 }
 
 // TODO: could add websocket under bitcoind as a custom property.